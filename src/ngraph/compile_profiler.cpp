@@ -0,0 +1,229 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+
+#include "ngraph/compile_profiler.hpp"
+#include "ngraph/log.hpp"
+#ifndef NGRAPH_JSON_DISABLE
+#include "nlohmann/json.hpp"
+#endif
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    const char* profile_prefix()
+    {
+        static const char* prefix = getenv("NGRAPH_COMPILE_PROFILE");
+        return prefix;
+    }
+
+    const chrono::steady_clock::time_point& profiler_epoch()
+    {
+        static const auto epoch = chrono::steady_clock::now();
+        return epoch;
+    }
+
+    bool write_file(const string& file_name, const string& contents)
+    {
+        ofstream out(file_name, ios_base::trunc);
+        out << contents;
+        out.close();
+        if (!out)
+        {
+            NGRAPH_WARN << "Unable to write compile profile " << file_name;
+            return false;
+        }
+        return true;
+    }
+
+    // Writes the profile named by NGRAPH_COMPILE_PROFILE once, at exit
+    struct ExitFlush
+    {
+        ~ExitFlush() { CompileProfiler::flush(); }
+    };
+}
+
+atomic<bool> CompileProfiler::s_enabled{profile_prefix() != nullptr};
+mutex CompileProfiler::s_mutex;
+vector<CompileProfiler::PassRecord> CompileProfiler::s_passes;
+map<pair<string, string>, CompileProfiler::MatcherRecord> CompileProfiler::s_matchers;
+vector<CompileProfiler::PhaseRecord> CompileProfiler::s_phases;
+
+// Defined after the records so that it is destroyed before them
+static ExitFlush s_exit_flush;
+
+CompileProfiler::Scope::Scope(const string& name, const string& category)
+    : m_event(name, category)
+    , m_enabled(CompileProfiler::is_enabled())
+{
+    if (m_enabled)
+    {
+        m_name = name;
+        m_category = category;
+        m_start_us = CompileProfiler::now_us();
+    }
+}
+
+CompileProfiler::Scope::~Scope()
+{
+    if (m_enabled)
+    {
+        CompileProfiler::record_phase(m_name, m_category, CompileProfiler::now_us() - m_start_us);
+    }
+}
+
+void CompileProfiler::enable()
+{
+    profiler_epoch();
+    s_enabled = true;
+}
+
+void CompileProfiler::disable()
+{
+    s_enabled = false;
+}
+
+void CompileProfiler::reset()
+{
+    lock_guard<mutex> lock(s_mutex);
+    s_passes.clear();
+    s_matchers.clear();
+    s_phases.clear();
+}
+
+int64_t CompileProfiler::now_us()
+{
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() -
+                                                       profiler_epoch())
+        .count();
+}
+
+void CompileProfiler::record_pass(const PassRecord& record)
+{
+    lock_guard<mutex> lock(s_mutex);
+    s_passes.push_back(record);
+}
+
+void CompileProfiler::record_matcher(const string& pass,
+                                     const string& matcher,
+                                     bool matched,
+                                     bool rewrote,
+                                     int64_t match_ns,
+                                     int64_t callback_ns)
+{
+    lock_guard<mutex> lock(s_mutex);
+    auto& record = s_matchers[make_pair(pass, matcher)];
+    record.attempts++;
+    record.matches += matched ? 1 : 0;
+    record.rewrites += rewrote ? 1 : 0;
+    record.match_ns += match_ns;
+    record.callback_ns += callback_ns;
+}
+
+void CompileProfiler::record_phase(const string& name, const string& category, int64_t duration_us)
+{
+    lock_guard<mutex> lock(s_mutex);
+    s_phases.push_back({name, category, duration_us});
+}
+
+vector<CompileProfiler::PassRecord> CompileProfiler::get_passes()
+{
+    lock_guard<mutex> lock(s_mutex);
+    return s_passes;
+}
+
+map<pair<string, string>, CompileProfiler::MatcherRecord> CompileProfiler::get_matchers()
+{
+    lock_guard<mutex> lock(s_mutex);
+    return s_matchers;
+}
+
+vector<CompileProfiler::PhaseRecord> CompileProfiler::get_phases()
+{
+    lock_guard<mutex> lock(s_mutex);
+    return s_phases;
+}
+
+string CompileProfiler::to_json()
+{
+#ifndef NGRAPH_JSON_DISABLE
+    nlohmann::json passes = nlohmann::json::array();
+    for (auto& pass : get_passes())
+    {
+        passes.push_back({{"name", pass.name},
+                          {"time_us", pass.duration_us},
+                          {"nodes_before", pass.nodes_before},
+                          {"nodes_after", pass.nodes_after}});
+    }
+
+    nlohmann::json matchers = nlohmann::json::array();
+    for (auto& matcher : get_matchers())
+    {
+        auto& record = matcher.second;
+        matchers.push_back({{"pass", matcher.first.first},
+                            {"matcher", matcher.first.second},
+                            {"attempts", record.attempts},
+                            {"matches", record.matches},
+                            {"rewrites", record.rewrites},
+                            {"match_us", record.match_ns / 1000},
+                            {"callback_us", record.callback_ns / 1000}});
+    }
+
+    // Phases such as per-op kernel builds repeat, so they are summed by category and name
+    map<pair<string, string>, pair<size_t, int64_t>> phase_totals;
+    for (auto& phase : get_phases())
+    {
+        auto& total = phase_totals[make_pair(phase.category, phase.name)];
+        total.first++;
+        total.second += phase.duration_us;
+    }
+    nlohmann::json phases = nlohmann::json::array();
+    for (auto& phase : phase_totals)
+    {
+        phases.push_back({{"category", phase.first.first},
+                          {"name", phase.first.second},
+                          {"count", phase.second.first},
+                          {"time_us", phase.second.second}});
+    }
+
+    nlohmann::json summary = {{"passes", passes}, {"matchers", matchers}, {"phases", phases}};
+    return summary.dump(2) + "\n";
+#else
+    return "";
+#endif
+}
+
+bool CompileProfiler::write(const string& prefix)
+{
+#ifndef NGRAPH_JSON_DISABLE
+    return write_file(prefix + ".json", to_json());
+#else
+    NGRAPH_WARN << "Compile profile " << prefix << ".json needs a build with JSON support";
+    return false;
+#endif
+}
+
+void CompileProfiler::flush()
+{
+    if (s_enabled && profile_prefix() != nullptr)
+    {
+        write(profile_prefix());
+    }
+}
@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ngraph/runtime/chrome_trace.hpp"
+
+namespace ngraph
+{
+    /// \brief Collects where compilation time goes: pass manager passes, GraphRewrite matchers
+    ///        and backend build phases.
+    ///
+    /// Profiling is off by default. It is enabled with enable() or by setting
+    /// NGRAPH_COMPILE_PROFILE to an output prefix, in which case a JSON summary is written to
+    /// <prefix>.json when the process exits or flush() is called. Passes and phases are also
+    /// emitted as runtime::event::Duration events, so with NGRAPH_ENABLE_TRACING set they show
+    /// up in the Chrome trace next to the runtime events.
+    class CompileProfiler
+    {
+    public:
+        struct PassRecord
+        {
+            std::string name;
+            size_t nodes_before;
+            size_t nodes_after;
+            int64_t duration_us;
+        };
+
+        struct MatcherRecord
+        {
+            size_t attempts;
+            size_t matches;
+            size_t rewrites;
+            int64_t match_ns;
+            int64_t callback_ns;
+        };
+
+        struct PhaseRecord
+        {
+            std::string name;
+            std::string category;
+            int64_t duration_us;
+        };
+
+        /// \brief Times a phase from construction to destruction.
+        class Scope
+        {
+        public:
+            Scope(const std::string& name, const std::string& category);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            runtime::event::Duration m_event;
+            bool m_enabled;
+            std::string m_name;
+            std::string m_category;
+            int64_t m_start_us;
+        };
+
+        static bool is_enabled() { return s_enabled; }
+        static void enable();
+        static void disable();
+        /// \brief Drops everything recorded so far.
+        static void reset();
+
+        /// \brief Microseconds since the profiler was loaded.
+        static int64_t now_us();
+
+        static void record_pass(const PassRecord& record);
+        /// \brief Accounts one match attempt of matcher `matcher` in GraphRewrite pass `pass`.
+        /// \param matched Whether the pattern matched.
+        /// \param rewrote Whether the callback reported a rewrite.
+        static void record_matcher(const std::string& pass,
+                                   const std::string& matcher,
+                                   bool matched,
+                                   bool rewrote,
+                                   int64_t match_ns,
+                                   int64_t callback_ns);
+        static void record_phase(const std::string& name,
+                                 const std::string& category,
+                                 int64_t duration_us);
+
+        static std::vector<PassRecord> get_passes();
+        static std::map<std::pair<std::string, std::string>, MatcherRecord> get_matchers();
+        static std::vector<PhaseRecord> get_phases();
+
+        /// \brief Summary with per-pass records, per-matcher totals and per-phase totals.
+        ///        Empty in builds without JSON support.
+        static std::string to_json();
+        /// \brief Writes the summary to <prefix>.json.
+        /// \returns false, after logging a warning, if the file could not be written
+        static bool write(const std::string& prefix);
+        /// \brief Writes the summary named by NGRAPH_COMPILE_PROFILE, if it is set.
+        static void flush();
+
+    private:
+        static std::atomic<bool> s_enabled;
+        static std::mutex s_mutex;
+        static std::vector<PassRecord> s_passes;
+        static std::map<std::pair<std::string, std::string>, MatcherRecord> s_matchers;
+        static std::vector<PhaseRecord> s_phases;
+    };
+}
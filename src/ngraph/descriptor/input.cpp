@@ -44,7 +44,11 @@ descriptor::Input::Input(Node* node, size_t index)
 
 descriptor::Input::~Input()
 {
-    remove_output();
+    // Not remove_output(), which would flag the node being destroyed for revalidation
+    if (m_output != nullptr)
+    {
+        m_output->remove_input(this);
+    }
 }
 
 void descriptor::Input::replace_output(Output& new_output)
@@ -56,6 +60,8 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    Node::invalidate_topology();
+    m_node->invalidate_validation();
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
@@ -80,6 +86,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        m_node->invalidate_validation();
     }
 }
 
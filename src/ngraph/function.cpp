@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_map>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -28,6 +29,87 @@ using namespace ngraph;
 
 atomic<size_t> Function::m_next_instance_id(0);
 
+// Checks that order is a complete execution order of f: it holds every result and parameter
+// of f, every node comes after its arguments and control dependencies, and every other node
+// feeds a later node, so nothing that was cut out of the graph remains. Unlike comparing with a
+// topological sort this only looks at the edges of the nodes in order.
+static bool is_valid_order(const vector<shared_ptr<Node>>& order, const Function& f)
+{
+    unordered_map<const Node*, size_t> position;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (!position.emplace(order[i].get(), i).second)
+        {
+            return false;
+        }
+    }
+    for (auto& result : f.get_results())
+    {
+        if (position.count(result.get()) == 0)
+        {
+            return false;
+        }
+    }
+    for (auto& param : f.get_parameters())
+    {
+        if (position.count(param.get()) == 0)
+        {
+            return false;
+        }
+    }
+    size_t num_results = 0;
+    size_t num_parameters = 0;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        Node* node = order[i].get();
+        for (auto& input : node->inputs())
+        {
+            auto it = position.find(input.get_source_output().get_node());
+            if (it == position.end() || it->second >= i)
+            {
+                return false;
+            }
+        }
+        for (auto& cdep : node->get_control_dependencies())
+        {
+            auto it = position.find(cdep.get());
+            if (it == position.end() || it->second >= i)
+            {
+                return false;
+            }
+        }
+        if (node->is_output())
+        {
+            num_results++;
+            continue;
+        }
+        if (node->is_parameter())
+        {
+            num_parameters++;
+            continue;
+        }
+        bool used = false;
+        for (auto& output : node->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                auto it = position.find(input.get_node());
+                used = used || (it != position.end() && it->second > i);
+            }
+        }
+        for (Node* dependent : node->get_control_dependents())
+        {
+            auto it = position.find(dependent);
+            used = used || (it != position.end() && it->second > i);
+        }
+        if (!used)
+        {
+            return false;
+        }
+    }
+    return num_results == f.get_results().size() && num_parameters == f.get_parameters().size();
+}
+
 Function::Function(const ResultVector& results,
                    const ParameterVector& parameters,
                    const std::string& name)
@@ -101,6 +183,42 @@ void Function::validate_nodes_and_infer_types()
     ngraph::validate_nodes_and_infer_types(get_ops());
 }
 
+size_t Function::revalidate_dirty_nodes()
+{
+    size_t count = 0;
+    vector<pair<element::Type, PartialShape>> output_types;
+    for (auto& node : get_ordered_ops())
+    {
+        if (!node->needs_validation())
+        {
+            continue;
+        }
+        output_types.clear();
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            output_types.emplace_back(node->get_output_element_type(i),
+                                      node->get_output_partial_shape(i));
+        }
+        node->revalidate_and_infer_types();
+        count++;
+        // Users only need revalidation if what they see of this node changed
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            if (i < output_types.size() &&
+                node->get_output_element_type(i) == output_types[i].first &&
+                node->get_output_partial_shape(i).same_scheme(output_types[i].second))
+            {
+                continue;
+            }
+            for (auto& input : node->output(i).get_target_inputs())
+            {
+                input.get_node()->invalidate_validation();
+            }
+        }
+    }
+    return count;
+}
+
 void Function::init()
 {
     validate_nodes_and_infer_types();
@@ -119,8 +237,26 @@ void Function::init()
                    true /*include control dependencies*/);
 }
 
-std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
+const vector<shared_ptr<Node>>& Function::get_ordered_ops(bool include_control_deps) const
 {
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    OrderedOpsCache& cache = m_ordered_ops_cache[include_control_deps ? 1 : 0];
+    size_t version = Node::get_topology_version();
+    if (cache.m_valid && cache.m_topology_version == version)
+    {
+        return cache.m_ops;
+    }
+    drop_stale_ordered_ops(version);
+
+    // An installed schedule survives graph edits elsewhere as long as it still orders this graph
+    if (include_control_deps && !m_schedule.empty())
+    {
+        cache.m_ops = m_schedule;
+        cache.m_topology_version = version;
+        cache.m_valid = true;
+        return cache.m_ops;
+    }
+
     NodeVector nodes;
     for (auto& r : get_results())
     {
@@ -131,7 +267,58 @@ std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps)
         nodes.push_back(param);
     }
 
-    return topological_sort(nodes, include_control_deps);
+    list<shared_ptr<Node>> sorted = topological_sort(nodes, include_control_deps);
+    cache.m_ops.assign(sorted.begin(), sorted.end());
+    cache.m_topology_version = version;
+    cache.m_valid = true;
+    return cache.m_ops;
+}
+
+void Function::set_ordered_ops(const vector<shared_ptr<Node>>& ordered_ops)
+{
+    if (!is_valid_order(ordered_ops, *this))
+    {
+        throw ngraph_error("Execution order of " + get_name() +
+                           " does not contain exactly its ops in dependency order");
+    }
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    size_t version = Node::get_topology_version();
+    m_schedule = ordered_ops;
+    m_schedule_version = version;
+    OrderedOpsCache& cache = m_ordered_ops_cache[1];
+    cache.m_ops = ordered_ops;
+    cache.m_topology_version = version;
+    cache.m_valid = true;
+}
+
+void Function::release_stale_ordered_ops() const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    drop_stale_ordered_ops(Node::get_topology_version());
+}
+
+void Function::drop_stale_ordered_ops(size_t version) const
+{
+    for (auto& cache : m_ordered_ops_cache)
+    {
+        if (cache.m_valid && cache.m_topology_version != version)
+        {
+            cache.m_ops.clear();
+            cache.m_valid = false;
+        }
+    }
+    if (!m_schedule.empty() && m_schedule_version != version)
+    {
+        if (is_valid_order(m_schedule, *this))
+        {
+            m_schedule_version = version;
+        }
+        else
+        {
+            NGRAPH_DEBUG << "Discarding stale execution order of " << get_name();
+            m_schedule.clear();
+        }
+    }
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -94,7 +95,24 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
-        std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Returns the function's ops in topological order.
+        ///
+        /// The order is computed once and cached until an edge of any graph is rewired (see
+        /// Node::get_topology_version), so repeated calls from passes and backends do not
+        /// re-sort an unchanged graph. The returned vector is the cache itself. It may be
+        /// iterated while the graph is edited, but is replaced by the next call after an edit,
+        /// so copy it if get_ordered_ops() may be called again before you are done with it.
+        const std::vector<std::shared_ptr<Node>>&
+            get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Installs an explicit execution order for the function's ops.
+        ///
+        /// The order must contain exactly the ops returned by get_ordered_ops() and respect every
+        /// data and control dependency. It is returned by get_ordered_ops() until a graph edit
+        /// makes it invalid, after which the default topological order is used again.
+        void set_ordered_ops(const std::vector<std::shared_ptr<Node>>& ordered_ops);
+        /// \brief Drops cached orders made stale by graph edits so they stop holding on to
+        ///        nodes that were removed from the graph.
+        void release_stale_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
         friend std::ostream& operator<<(std::ostream&, const Function&);
@@ -106,6 +124,12 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Revalidates, in topological order, the nodes marked by
+        ///        Node::invalidate_validation and the users of every node whose output types
+        ///        change on revalidation. Other nodes are left alone.
+        /// \returns The number of nodes revalidated.
+        size_t revalidate_dirty_nodes();
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -132,5 +156,22 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+
+        struct OrderedOpsCache
+        {
+            bool m_valid{false};
+            size_t m_topology_version{0};
+            std::vector<std::shared_ptr<Node>> m_ops;
+        };
+        // Indexed by include_control_deps
+        mutable OrderedOpsCache m_ordered_ops_cache[2];
+        // Order installed by set_ordered_ops, empty if none
+        mutable std::vector<std::shared_ptr<Node>> m_schedule;
+        // Topology version at which m_schedule was last checked
+        mutable size_t m_schedule_version{0};
+        mutable std::mutex m_ordered_ops_mutex;
+
+        // Clears the caches older than version. Requires m_ordered_ops_mutex.
+        void drop_stale_ordered_ops(size_t version) const;
     };
 }
@@ -132,6 +132,20 @@ NodeVector ngraph::find_common_args(std::shared_ptr<Node> node1, std::shared_ptr
     return common_args;
 }
 
+static thread_local ngraph::ReplaceNodeObserver* s_replace_node_observer = nullptr;
+
+ngraph::ReplaceNodeObserver::ReplaceNodeObserver(const Callback& callback)
+    : m_callback(callback)
+    , m_previous(s_replace_node_observer)
+{
+    s_replace_node_observer = this;
+}
+
+ngraph::ReplaceNodeObserver::~ReplaceNodeObserver()
+{
+    s_replace_node_observer = m_previous;
+}
+
 void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement)
 {
     if (target->is_output())
@@ -177,6 +191,11 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
 
     replacement->add_node_control_dependents(target);
     target->clear_control_dependents();
+
+    if (s_replace_node_observer != nullptr)
+    {
+        s_replace_node_observer->m_callback(target, replacement);
+    }
 }
 
 // Check if all paths from X to a result go through Y
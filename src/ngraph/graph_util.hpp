@@ -214,6 +214,27 @@ namespace ngraph
     ///        replace_node(N, M);
     void replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
 
+    /// \brief While alive, reports every replace_node(target, replacement) made on the current
+    ///        thread to a callback. Observers nest; only the innermost one is notified.
+    class ReplaceNodeObserver
+    {
+    public:
+        using Callback = std::function<void(const std::shared_ptr<Node>& target,
+                                            const std::shared_ptr<Node>& replacement)>;
+
+        explicit ReplaceNodeObserver(const Callback& callback);
+        ~ReplaceNodeObserver();
+
+        ReplaceNodeObserver(const ReplaceNodeObserver&) = delete;
+        ReplaceNodeObserver& operator=(const ReplaceNodeObserver&) = delete;
+
+    private:
+        friend void replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
+
+        Callback m_callback;
+        ReplaceNodeObserver* m_previous;
+    };
+
     NodeVector find_common_args(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
 
     /// Topological sort of nodes needed to compute root_nodes
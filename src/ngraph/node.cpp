@@ -33,6 +33,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::s_topology_version(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -41,7 +42,7 @@ Node::Node(size_t output_size)
 }
 
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
-    : m_node_type(node_type)
+    : m_node_type(&node_type)
 {
     set_arguments(arguments);
     set_output_size(output_size);
@@ -207,6 +208,7 @@ void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
     validate_and_infer_types();
+    m_needs_validation = false;
 #endif
 }
 
@@ -214,6 +216,7 @@ void Node::delayed_validate_and_infer_types()
 {
 #ifndef IN_TRANSITION
     validate_and_infer_types();
+    m_needs_validation = false;
 #endif
 }
 #undef IN_TRANSITION
@@ -247,12 +250,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+StableVector<descriptor::Output, 1>& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const StableVector<descriptor::Output, 1>& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -274,7 +277,8 @@ bool Node::is_constant() const
 
 const std::string& Node::description() const
 {
-    return m_node_type;
+    static const string empty;
+    return m_node_type ? *m_node_type : empty;
 }
 
 const std::string& Node::get_friendly_name() const
@@ -383,6 +387,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        invalidate_topology();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -414,6 +419,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_topology();
         }
     }
     {
@@ -435,7 +441,11 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
-    m_control_dependencies.clear();
+    if (!m_control_dependencies.empty())
+    {
+        m_control_dependencies.clear();
+        invalidate_topology();
+    }
 }
 
 void Node::clear_control_dependents()
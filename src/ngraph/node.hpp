@@ -17,7 +17,6 @@
 #pragma once
 
 #include <atomic>
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -37,6 +36,7 @@
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 
 namespace ngraph
@@ -124,7 +124,10 @@ namespace ngraph
         Node(const OutputVector& arguments, size_t output_size = 1);
 
         /// \brief Construct a node with arguments. Will be deprecated.
+        /// \param node_type Type name returned by description(). Only a pointer to it is kept,
+        ///        so it has to outlive the node, normally as a static member of the op class.
         Node(const std::string& node_type, const NodeVector& arguments, size_t output_size = 1);
+        Node(std::string&& node_type, const NodeVector& arguments, size_t output_size = 1) = delete;
 
         /// \brief Constructor for Node subclasses that have metaclasses. Will be deprecated.
         /// \param arguments The 0th output of node i will connect to input i
@@ -149,7 +152,15 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            validate_and_infer_types();
+            m_needs_validation = false;
+        }
+        /// \brief Marks the node for revalidation by Function::revalidate_dirty_nodes. Called
+        ///        when one of the node's inputs is reconnected.
+        void invalidate_validation() { m_needs_validation = true; }
+        bool needs_validation() const { return m_needs_validation; }
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -224,17 +235,18 @@ namespace ngraph
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        StableVector<descriptor::Input, 2>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
+        const StableVector<descriptor::Input, 2>& get_inputs() const
             NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
+        StableVector<descriptor::Output, 1>& get_outputs()
+            NGRAPH_DEPRECATED("use outputs() instead");
+        const StableVector<descriptor::Output, 1>& get_outputs() const
             NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
@@ -261,6 +273,13 @@ namespace ngraph
         /// This node becomes a dependent of every node dependent on source_node
         void add_node_control_dependents(std::shared_ptr<Node> source_node);
 
+        /// \brief Returns a counter that advances whenever a data or control edge of any node
+        ///        is rewired. Function uses it to tell whether a cached topological order is
+        ///        still valid.
+        static size_t get_topology_version() { return s_topology_version.load(); }
+        /// \brief Marks every cached topological order as stale.
+        static void invalidate_topology() { s_topology_version.fetch_add(1); }
+
         /// Returns the number of outputs from the node.
         size_t get_output_size() const;
 
@@ -425,18 +444,22 @@ namespace ngraph
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        const std::string m_node_type;
+        // Static type name of the op class, shared by all of its nodes
+        const std::string* m_node_type{nullptr};
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         NGRAPH_API
         static std::atomic<size_t> m_next_instance_id;
+        NGRAPH_API
+        static std::atomic<size_t> s_topology_version;
         std::unordered_set<std::string> m_provenance_tags;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        StableVector<descriptor::Input, 2> m_inputs;
+        StableVector<descriptor::Output, 1> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
         size_t m_placement_index = placement_invalid;
+        bool m_needs_validation{false};
     };
 
     /// \brief A handle for one of a node's inputs.
@@ -48,6 +48,7 @@ namespace ngraph
             Op(const NodeVector& arguments);
             Op(const OutputVector& arguments);
             Op(const std::string& node_type, const NodeVector& arguments);
+            Op(std::string&& node_type, const NodeVector& arguments) = delete;
 
         private:
             std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
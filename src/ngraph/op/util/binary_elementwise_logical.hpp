@@ -80,6 +80,11 @@ namespace ngraph
                                          const std::shared_ptr<Node>& arg0,
                                          const std::shared_ptr<Node>& arg1,
                                          const AutoBroadcastSpec& autob = AutoBroadcastSpec());
+                BinaryElementwiseLogical(std::string&& node_type,
+                                         const std::shared_ptr<Node>& arg0,
+                                         const std::shared_ptr<Node>& arg1,
+                                         const AutoBroadcastSpec& autob =
+                                             AutoBroadcastSpec()) = delete;
 
             public:
                 void validate_and_infer_types() override;
@@ -58,6 +58,7 @@ namespace ngraph
                 ///
                 /// \param args Nodes that produce the input tensors for the fused op
                 FusedOp(const std::string& node_type, const NodeVector& args);
+                FusedOp(std::string&& node_type, const NodeVector& args) = delete;
             };
         }
     }
@@ -46,6 +46,10 @@ namespace ngraph
                                const std::shared_ptr<Node>& arg,
                                size_t axis,
                                const element::Type& index_element_type);
+                IndexReduction(std::string&& node_type,
+                               const std::shared_ptr<Node>& arg,
+                               size_t axis,
+                               const element::Type& index_element_type) = delete;
 
             public:
                 size_t get_reduction_axis() const;
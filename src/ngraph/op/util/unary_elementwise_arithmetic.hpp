@@ -64,6 +64,8 @@ namespace ngraph
                 /// \param arg Node that produces the input tensor.
                 UnaryElementwiseArithmetic(const std::string& node_type,
                                            const std::shared_ptr<Node>& arg);
+                UnaryElementwiseArithmetic(std::string&& node_type,
+                                           const std::shared_ptr<Node>& arg) = delete;
 
             public:
                 void validate_and_infer_types() override;
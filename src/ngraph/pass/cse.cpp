@@ -59,6 +59,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/serializer.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -185,6 +186,52 @@ static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node
 static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
     ops_to_cse_handlers = initialize_ops_to_cse_handlers();
 
+// Ops without a handler are compared structurally: same op, same arguments, same attributes
+// as written by the serializer and same output types. This covers every op the serializer
+// knows, including fused and experimental ones.
+static string generic_cse_attributes(const Node& node)
+{
+    // Collectives and point-to-point ops must run once per occurrence on every rank
+    static const set<string> never_merged{"AllReduce", "BroadcastDistributed", "Recv", "Send"};
+    if (node.has_state() || node.is_constant() || node.get_output_size() == 0 ||
+        never_merged.count(node.description()) != 0)
+    {
+        return "";
+    }
+    return serialize_node_attributes(node);
+}
+
+static vector<Output<Node>> cse_arguments(const Node& node)
+{
+    vector<Output<Node>> args;
+    for (auto input : node.inputs())
+    {
+        args.push_back(input.get_source_output());
+    }
+    if (node.is_commutative())
+    {
+        sort(begin(args), end(args));
+    }
+    return args;
+}
+
+static bool cse_generic(const Node& a, const Node& b)
+{
+    if (a.get_output_size() != b.get_output_size() || cse_arguments(a) != cse_arguments(b))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.get_output_size(); i++)
+    {
+        if (a.get_output_element_type(i) != b.get_output_element_type(i) ||
+            !a.get_output_partial_shape(i).same_scheme(b.get_output_partial_shape(i)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 class NodeKey
 {
 public:
@@ -194,9 +241,15 @@ public:
         : m_node(n)
         , m_backend_handlers(backend_handlers)
     {
+        auto ti = TI(*n);
+        if (ops_to_cse_handlers.count(ti) == 0 && m_backend_handlers.count(ti) == 0)
+        {
+            m_attributes = generic_cse_attributes(*n);
+        }
     }
 
     shared_ptr<Node> get_node() const { return m_node; }
+    const string& get_attributes() const { return m_attributes; }
     bool operator==(const NodeKey& other) const
     {
         Node& p_this = *m_node.get();
@@ -223,13 +276,16 @@ public:
             }
         }
 
-        return false;
+        return !m_attributes.empty() && m_attributes == other.get_attributes() &&
+               cse_generic(p_this, p_other);
     }
 
 private:
     shared_ptr<Node> m_node;
     unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
         m_backend_handlers;
+    // Serialized attributes for the generic comparison, empty if it does not apply
+    string m_attributes;
 };
 
 namespace std
@@ -249,24 +305,12 @@ namespace std
 
             arg_ids.push_back(type_hash);
 
-            std::vector<Output<Node>> cargs;
-            for (auto input : k.get_node()->inputs())
-            {
-                cargs.push_back(input.get_source_output());
-            }
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
+            for (auto arg : cse_arguments(p_this))
             {
                 arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
                 arg_ids.push_back(arg.get_index());
             }
+            arg_ids.push_back(hash<string>{}(k.get_attributes()));
 
             auto hashc = ngraph::hash_combine(arg_ids);
             return hashc;
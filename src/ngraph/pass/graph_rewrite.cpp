@@ -15,17 +15,66 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
+#include <deque>
 #include <iostream>
 #include <regex>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
+#include "ngraph/compile_profiler.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Tries one matcher closure on node. Returns true if the callback rewrote the graph. With a
+    // pass name, the time spent in the pattern match and in the callback is accounted to the
+    // compile profiler.
+    template <typename Closure>
+    bool try_matcher(Closure& closure, const shared_ptr<Node>& node, const string* profile_pass)
+    {
+        chrono::steady_clock::time_point start;
+        if (profile_pass)
+        {
+            start = chrono::steady_clock::now();
+        }
+        bool matched = closure.matcher->match(node);
+        chrono::steady_clock::time_point matched_at;
+        if (profile_pass)
+        {
+            matched_at = chrono::steady_clock::now();
+        }
+        bool rewrote = false;
+        if (matched)
+        {
+            NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
+                         << " matched " << node->get_name();
+            rewrote = closure.callback(*closure.matcher.get());
+        }
+        if (profile_pass)
+        {
+            auto end = chrono::steady_clock::now();
+            CompileProfiler::record_matcher(
+                *profile_pass,
+                closure.matcher->get_name(),
+                matched,
+                rewrote,
+                chrono::duration_cast<chrono::nanoseconds>(matched_at - start).count(),
+                chrono::duration_cast<chrono::nanoseconds>(end - matched_at).count());
+        }
+        return rewrote;
+    }
+}
+
 // GraphRewrite algorithm:
 // GraphRewrite processes an input graph in an topological order(i.e. args before users)
 // Given the following graph:          Abs2
@@ -60,6 +109,14 @@ using namespace ngraph;
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
 
+// Incremental mode:
+// With set_incremental(true), replace_node calls made by successful callbacks are recorded.
+// After each sweep, the replacements, their users and their arguments form a worklist. The
+// same matchers are tried on the worklist, and every further replacement enqueues its own
+// neighbourhood, until the worklist is empty. Nodes created by a rewrite are matched right
+// away instead of waiting for another run of the pass. Each node is tried at most NUM_TRIES
+// times from the worklist, so matchers that keep rewriting their own output terminate.
+
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     bool rewritten = false;
@@ -71,6 +128,36 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     static bool s_rerun_dynamic_check =
         (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
     bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+    bool profile = CompileProfiler::is_enabled();
+    string pass_name = profile ? get_name() : "";
+
+    // Frontier of incremental rewriting
+    deque<shared_ptr<Node>> worklist;
+    unordered_set<Node*> in_worklist;
+    unordered_map<Node*, size_t> worklist_visits;
+    auto enqueue = [&](const shared_ptr<Node>& node) {
+        if (in_worklist.insert(node.get()).second)
+        {
+            worklist.push_back(node);
+        }
+    };
+    unique_ptr<ReplaceNodeObserver> observer;
+    if (m_incremental)
+    {
+        observer.reset(new ReplaceNodeObserver(
+            [&](const shared_ptr<Node>& target, const shared_ptr<Node>& replacement) {
+                enqueue(replacement);
+                for (auto& user : replacement->get_users())
+                {
+                    enqueue(user);
+                }
+                for (auto& arg : target->get_arguments())
+                {
+                    enqueue(arg);
+                }
+            }));
+    }
+
     do
     {
         rewritten = false;
@@ -78,10 +165,42 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
-        for (auto node : f->get_ordered_ops())
+
+        // Index the matchers by the type of their pattern root. A node can only be matched by
+        // matchers whose root has the exact type of the node or is a pattern op such as Label
+        // or Any, so only those are tried. Indices stay in registration order.
+        unordered_map<type_index, vector<size_t>> typed_matchers;
+        vector<size_t> wildcard_matchers;
+        for (size_t i = 0; i < matchers_to_run.size(); i++)
         {
-            for (auto& closure : matchers_to_run)
+            auto& pattern = *matchers_to_run[i].matcher->get_pattern();
+            if (dynamic_cast<pattern::op::Pattern*>(&pattern))
+            {
+                wildcard_matchers.push_back(i);
+            }
+            else
+            {
+                typed_matchers[type_index(typeid(pattern))].push_back(i);
+            }
+        }
+        const vector<size_t> no_matchers;
+
+        // Returns true if a matcher rewrote the graph at node
+        auto run_matchers = [&](const shared_ptr<Node>& node) {
+            auto& n = *node;
+            auto typed_it = typed_matchers.find(type_index(typeid(n)));
+            const auto& typed = typed_it == typed_matchers.end() ? no_matchers : typed_it->second;
+            size_t typed_pos = 0;
+            size_t wildcard_pos = 0;
+            while (typed_pos < typed.size() || wildcard_pos < wildcard_matchers.size())
             {
+                // Merge both candidate lists to preserve the registration order
+                bool take_typed = typed_pos < typed.size() &&
+                                  (wildcard_pos == wildcard_matchers.size() ||
+                                   typed[typed_pos] < wildcard_matchers[wildcard_pos]);
+                size_t index =
+                    take_typed ? typed[typed_pos++] : wildcard_matchers[wildcard_pos++];
+                auto& closure = matchers_to_run[index];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -93,23 +212,43 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
                              << closure.matcher->get_pattern()->get_name() << ") on "
                              << node->get_name();
-                if (closure.matcher->match(node))
+                if (try_matcher(closure, node, profile ? &pass_name : nullptr))
                 {
-                    NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
-                                 << " matched " << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
+                    // If call back may change function's is_dynamic state, we need to
+                    // update the cached value.
+                    if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
                     {
-                        rewritten = true;
-                        // If call back may change function's is_dynamic state, we need to
-                        // update the cached value.
-                        if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
-                        {
-                            is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
-                        }
-                        break;
+                        is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
                     }
+                    return true;
                 }
             }
+            return false;
+        };
+
+        for (auto node : f->get_ordered_ops())
+        {
+            if (run_matchers(node))
+            {
+                rewritten = true;
+            }
+        }
+
+        while (!worklist.empty())
+        {
+            auto node = worklist.front();
+            worklist.pop_front();
+            in_worklist.erase(node.get());
+            // Skip nodes that were rewritten away
+            if ((node->get_users().empty() && !node->is_output()) ||
+                worklist_visits[node.get()]++ >= NUM_TRIES)
+            {
+                continue;
+            }
+            if (run_matchers(node))
+            {
+                rewritten = true;
+            }
         }
 
     } while (rewritten && m_matchers.size() > 0 && tries--);
@@ -118,6 +257,18 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     return (NUM_TRIES - tries) > 1; // this means a graph was transformed
 }
 
+void pass::GraphRewrite::add_matchers(const GraphRewrite& other)
+{
+    for (auto& closure : other.m_matchers)
+    {
+        m_matchers.push_back(closure);
+        if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+        {
+            set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+        }
+    }
+}
+
 static vector<regex> initialize_fusion_regexes()
 {
     const char* cnsf = getenv("NGRAPH_DISABLED_FUSIONS");
@@ -66,6 +66,14 @@ public:
     void add_matcher(const std::shared_ptr<pattern::Matcher>& m,
                      const ngraph::graph_rewrite_callback& callback);
 
+    /// \brief Copy the matchers registered with another GraphRewrite, which must outlive this
+    ///        pass, so that several rewrites run to a joint fixpoint
+    void add_matchers(const GraphRewrite& other);
+
+    /// \brief In incremental mode nodes affected by a replace_node in a callback are matched
+    ///        again from a worklist until no more rewrites apply, instead of waiting for the
+    ///        next run of the pass
+    void set_incremental(bool incremental) { m_incremental = incremental; }
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
 protected:
@@ -79,6 +87,7 @@ private:
         PassPropertyMask property;
     };
     std::vector<MatchClosure> m_matchers;
+    bool m_incremental = false;
 };
 
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
@@ -15,14 +15,11 @@
 //*****************************************************************************
 
 #include <algorithm>
-#ifdef _WIN32
-#else
-#include <cxxabi.h>
-#endif
 #include <iomanip>
 #include <iostream>
 #include <memory>
 
+#include "ngraph/compile_profiler.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
@@ -65,8 +62,25 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    bool compile_profile_enabled = CompileProfiler::is_enabled();
+    auto count_nodes = [&]() {
+        size_t count = 0;
+        for (auto& f : f_array)
+        {
+            count += f->get_ops().size();
+        }
+        return count;
+    };
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        runtime::event::Duration pass_event(pass->get_name(), "pass");
+        int64_t pass_start_us = 0;
+        size_t nodes_before = 0;
+        if (compile_profile_enabled)
+        {
+            nodes_before = count_nodes();
+            pass_start_us = CompileProfiler::now_us();
+        }
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -129,11 +143,19 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
                 {
                     continue;
                 }
-                bool function_modified = call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                auto ordered_ops = f->get_ordered_ops();
+                bool function_modified = call_graph_pass->run_on_call_graph(
+                    list<shared_ptr<Node>>(ordered_ops.begin(), ordered_ops.end()));
                 f_pair.second = (function_modified == true) ? f->is_dynamic() : f_pair.second;
             }
         }
 
+        // Let go of the nodes the pass cut out of the graph
+        for (auto& f : f_array)
+        {
+            f->release_stale_ordered_ops();
+        }
+
         if (m_visualize || m_serialize)
         {
             // visualizations and serializations will be named after the outermost function
@@ -162,13 +184,13 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
         pass_timer.stop();
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+        }
+        if (compile_profile_enabled)
+        {
+            int64_t pass_time_us = CompileProfiler::now_us() - pass_start_us;
+            CompileProfiler::record_pass(
+                {pass->get_name(), nodes_before, count_nodes(), pass_time_us});
         }
     }
     if (profile_enabled)
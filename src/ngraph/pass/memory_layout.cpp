@@ -14,8 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <map>
+#include <numeric>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
@@ -42,7 +46,12 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // Collect every temporary's lifetime first and let the planner place them all at once.
+    // Tensors that are computed in place share the buffer of the input they overwrite.
+    MemoryPlanner planner(m_alignment);
+    unordered_map<descriptor::Tensor*, size_t> tensor_buffers;
+    vector<descriptor::Tensor*> tensors;
+    size_t index = 0;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -84,24 +93,40 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
-            tensor->set_pool_offset(offset);
+            size_t buffer;
+            if (in_place_outputs.count(tensor))
+            {
+                buffer = tensor_buffers.at(in_place_outputs.at(tensor));
+                planner.grow(buffer, tensor->size());
+            }
+            else
+            {
+                buffer = planner.add_buffer(tensor->size(), index);
+            }
+            tensor_buffers[tensor] = buffer;
+            tensors.push_back(tensor);
         }
 
+        // With memory sharing disabled every buffer stays live to the end, so none overlap
         if (!m_disable_memory_sharing)
         {
-            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
             {
                 if (reused_inputs.count(tensor) == 0)
                 {
-                    mm.free(tensor->get_pool_offset());
+                    planner.set_last_use(tensor_buffers.at(tensor), index);
                 }
             }
         }
+        index++;
+    }
+
+    planner.plan();
+    for (descriptor::Tensor* tensor : tensors)
+    {
+        tensor->set_pool_offset(planner.get_offset(tensor_buffers.at(tensor)));
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+    function->set_temporary_pool_size(planner.peak());
 
     return false;
 }
@@ -291,3 +316,320 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+const size_t pass::MemoryPlanner::end_of_program = numeric_limits<size_t>::max();
+const size_t pass::MemoryPlanner::default_exact_limit;
+
+pass::MemoryPlanner::MemoryPlanner(size_t alignment, strategy s, size_t exact_limit)
+    : m_alignment{alignment}
+    , m_strategy{s}
+    , m_exact_limit{exact_limit}
+    , m_peak{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+size_t pass::MemoryPlanner::add_buffer(size_t size, size_t first_use, size_t last_use)
+{
+    if (last_use < first_use)
+    {
+        throw invalid_argument("Buffer last use precedes its first use");
+    }
+    m_buffers.push_back(buffer{MemoryManager::align(size, m_alignment),
+                               first_use,
+                               last_use,
+                               last_use != end_of_program});
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryPlanner::set_last_use(size_t b, size_t last_use)
+{
+    buffer& buf = m_buffers.at(b);
+    if (last_use < buf.m_first_use)
+    {
+        throw invalid_argument("Buffer last use precedes its first use");
+    }
+    buf.m_last_use = buf.m_last_use_set ? max(buf.m_last_use, last_use) : last_use;
+    buf.m_last_use_set = true;
+}
+
+void pass::MemoryPlanner::grow(size_t b, size_t size)
+{
+    buffer& buf = m_buffers.at(b);
+    buf.m_size = max(buf.m_size, MemoryManager::align(size, m_alignment));
+}
+
+size_t pass::MemoryPlanner::get_offset(size_t b) const
+{
+    if (b >= m_offsets.size())
+    {
+        throw runtime_error("MemoryPlanner::plan() must be called before get_offset()");
+    }
+    return m_offsets[b];
+}
+
+size_t pass::MemoryPlanner::lower_bound() const
+{
+    // Sweep over interval endpoints. Intervals are closed, so at equal program points a buffer
+    // starting there is counted before one ending there is released.
+    vector<pair<size_t, ptrdiff_t>> events;
+    events.reserve(2 * m_buffers.size());
+    for (const buffer& buf : m_buffers)
+    {
+        events.emplace_back(buf.m_first_use, static_cast<ptrdiff_t>(buf.m_size));
+        if (buf.m_last_use != end_of_program)
+        {
+            events.emplace_back(buf.m_last_use + 1, -static_cast<ptrdiff_t>(buf.m_size));
+        }
+    }
+    sort(events.begin(), events.end());
+    ptrdiff_t live = 0;
+    ptrdiff_t bound = 0;
+    for (const auto& e : events)
+    {
+        live += e.second;
+        bound = max(bound, live);
+    }
+    return static_cast<size_t>(bound);
+}
+
+bool pass::MemoryPlanner::overlaps(size_t a, size_t b) const
+{
+    const buffer& x = m_buffers[a];
+    const buffer& y = m_buffers[b];
+    return x.m_first_use <= y.m_last_use && y.m_first_use <= x.m_last_use;
+}
+
+namespace
+{
+    // Placed buffers indexed by lifetime, so that finding the buffers whose lifetimes overlap a
+    // new one does not scan every placed buffer. A lifetime overlaps [first, last] if it
+    // contains first or starts in (first, last]. The former are found with a segment tree over
+    // the distinct first uses, the latter with an ordered map of first uses.
+    class LifetimeIndex
+    {
+    public:
+        LifetimeIndex(vector<size_t> first_uses)
+            : m_points(move(first_uses))
+        {
+            sort(m_points.begin(), m_points.end());
+            m_points.erase(unique(m_points.begin(), m_points.end()), m_points.end());
+            m_tree.resize(2 * m_points.size());
+        }
+
+        // first must be one of the first uses the index was built with
+        void insert(size_t id, size_t first, size_t last)
+        {
+            size_t l = point(first) + m_points.size();
+            size_t r = upper_bound(m_points.begin(), m_points.end(), last) - m_points.begin() +
+                       m_points.size();
+            for (; l < r; l >>= 1, r >>= 1)
+            {
+                if (l & 1)
+                {
+                    m_tree[l++].push_back(id);
+                }
+                if (r & 1)
+                {
+                    m_tree[--r].push_back(id);
+                }
+            }
+            m_starts.emplace(first, id);
+        }
+
+        // Appends every inserted id whose lifetime overlaps [first, last]
+        void find_overlaps(size_t first, size_t last, vector<size_t>& overlaps) const
+        {
+            for (size_t node = point(first) + m_points.size(); node > 0; node >>= 1)
+            {
+                overlaps.insert(overlaps.end(), m_tree[node].begin(), m_tree[node].end());
+            }
+            for (auto it = m_starts.upper_bound(first), end = m_starts.upper_bound(last);
+                 it != end;
+                 ++it)
+            {
+                overlaps.push_back(it->second);
+            }
+        }
+
+    private:
+        size_t point(size_t first) const
+        {
+            return lower_bound(m_points.begin(), m_points.end(), first) - m_points.begin();
+        }
+
+        vector<size_t> m_points;
+        vector<vector<size_t>> m_tree;
+        multimap<size_t, size_t> m_starts;
+    };
+}
+
+// conflicts holds the placed buffers whose lifetimes overlap b's, and is reordered by offset
+size_t pass::MemoryPlanner::find_offset(size_t b,
+                                        vector<size_t>& conflicts,
+                                        const vector<size_t>& offsets,
+                                        bool best_fit) const
+{
+    sort(conflicts.begin(), conflicts.end(), [&offsets](size_t x, size_t y) {
+        return offsets[x] < offsets[y];
+    });
+
+    size_t size = m_buffers[b].m_size;
+    size_t cursor = 0;
+    size_t best_offset = end_of_program;
+    size_t best_gap = end_of_program;
+    for (size_t p : conflicts)
+    {
+        if (offsets[p] > cursor)
+        {
+            size_t gap = offsets[p] - cursor;
+            if (gap >= size)
+            {
+                if (!best_fit)
+                {
+                    return cursor;
+                }
+                if (gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = cursor;
+                }
+            }
+        }
+        cursor = max(cursor, offsets[p] + m_buffers[p].m_size);
+    }
+    return best_offset != end_of_program ? best_offset : cursor;
+}
+
+size_t pass::MemoryPlanner::place(const vector<size_t>& order,
+                                  bool best_fit,
+                                  vector<size_t>& offsets) const
+{
+    offsets.assign(m_buffers.size(), 0);
+    vector<size_t> first_uses;
+    first_uses.reserve(m_buffers.size());
+    for (const buffer& buf : m_buffers)
+    {
+        first_uses.push_back(buf.m_first_use);
+    }
+    LifetimeIndex placed(move(first_uses));
+    vector<size_t> conflicts;
+    size_t peak = 0;
+    for (size_t b : order)
+    {
+        const buffer& buf = m_buffers[b];
+        conflicts.clear();
+        placed.find_overlaps(buf.m_first_use, buf.m_last_use, conflicts);
+        offsets[b] = find_offset(b, conflicts, offsets, best_fit);
+        peak = max(peak, offsets[b] + buf.m_size);
+        placed.insert(b, buf.m_first_use, buf.m_last_use);
+    }
+    return peak;
+}
+
+void pass::MemoryPlanner::search(vector<size_t>& placed,
+                                 vector<bool>& is_placed,
+                                 vector<size_t>& offsets,
+                                 size_t current_peak,
+                                 size_t bound,
+                                 vector<size_t>& best_offsets,
+                                 size_t& best_peak) const
+{
+    if (placed.size() == m_buffers.size())
+    {
+        if (current_peak < best_peak)
+        {
+            best_peak = current_peak;
+            best_offsets = offsets;
+        }
+        return;
+    }
+    // Every packing can be rebuilt by placing its buffers in order of offset, each at the
+    // lowest offset that fits, so searching first-fit placement orders finds the optimum.
+    for (size_t b = 0; b < m_buffers.size() && best_peak > bound; ++b)
+    {
+        if (is_placed[b])
+        {
+            continue;
+        }
+        // The search only runs on a handful of buffers, so a scan finds the conflicts
+        vector<size_t> conflicts;
+        for (size_t p : placed)
+        {
+            if (overlaps(b, p))
+            {
+                conflicts.push_back(p);
+            }
+        }
+        size_t offset = find_offset(b, conflicts, offsets, false);
+        size_t peak = max(current_peak, offset + m_buffers[b].m_size);
+        if (peak >= best_peak)
+        {
+            continue;
+        }
+        offsets[b] = offset;
+        is_placed[b] = true;
+        placed.push_back(b);
+        search(placed, is_placed, offsets, peak, bound, best_offsets, best_peak);
+        placed.pop_back();
+        is_placed[b] = false;
+    }
+}
+
+size_t pass::MemoryPlanner::plan()
+{
+    size_t count = m_buffers.size();
+    vector<size_t> by_size(count);
+    iota(by_size.begin(), by_size.end(), 0);
+    vector<size_t> by_lifetime = by_size;
+    vector<size_t> by_order = by_size;
+
+    stable_sort(by_size.begin(), by_size.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_size > m_buffers[b].m_size;
+    });
+    stable_sort(by_lifetime.begin(), by_lifetime.end(), [this](size_t a, size_t b) {
+        size_t la = m_buffers[a].m_last_use - m_buffers[a].m_first_use;
+        size_t lb = m_buffers[b].m_last_use - m_buffers[b].m_first_use;
+        return la != lb ? la > lb : m_buffers[a].m_size > m_buffers[b].m_size;
+    });
+    stable_sort(by_order.begin(), by_order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_first_use < m_buffers[b].m_first_use;
+    });
+
+    vector<size_t> offsets;
+    switch (m_strategy)
+    {
+    case strategy::GREEDY_BY_SIZE: m_peak = place(by_size, true, m_offsets); break;
+    case strategy::GREEDY_BY_LIFETIME: m_peak = place(by_lifetime, true, m_offsets); break;
+    case strategy::GREEDY_BY_ORDER: m_peak = place(by_order, false, m_offsets); break;
+    case strategy::BEST:
+    case strategy::EXACT:
+        m_peak = place(by_size, true, m_offsets);
+        for (auto order : {&by_lifetime, &by_order})
+        {
+            size_t peak = place(*order, order == &by_lifetime, offsets);
+            if (peak < m_peak)
+            {
+                m_peak = peak;
+                m_offsets.swap(offsets);
+            }
+        }
+        break;
+    }
+
+    size_t bound = lower_bound();
+    if (m_strategy == strategy::EXACT && count <= m_exact_limit && m_peak > bound)
+    {
+        vector<size_t> placed;
+        vector<bool> is_placed(count, false);
+        offsets.assign(count, 0);
+        search(placed, is_placed, offsets, 0, bound, m_offsets, m_peak);
+    }
+
+    NGRAPH_DEBUG << "MemoryPlanner: placed " << count << " buffers, peak " << m_peak
+                 << " bytes, lower bound " << bound << " bytes";
+    return m_peak;
+}
@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,6 +30,7 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryPlanner;
     }
 }
 
@@ -95,3 +97,91 @@ private:
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// \brief Offline planner that places a set of buffers with known lifetimes in a single pool.
+///
+/// Unlike MemoryManager, which assigns offsets greedily as buffers are allocated in program
+/// order, the planner sees every buffer's [first_use, last_use] interval up front and packs them
+/// globally. Two buffers may share memory only if their intervals do not overlap.
+class ngraph::pass::MemoryPlanner
+{
+public:
+    enum class strategy
+    {
+        /// Place largest buffers first, each in the tightest gap that fits.
+        GREEDY_BY_SIZE,
+        /// Place longest-lived buffers first, each in the tightest gap that fits.
+        GREEDY_BY_LIFETIME,
+        /// Place buffers in order of first use, each at the lowest offset that fits.
+        GREEDY_BY_ORDER,
+        /// Run every greedy strategy and keep the one with the smallest peak.
+        BEST,
+        /// Search all placement orders for the optimal peak when there are at most
+        /// `exact_limit` buffers, otherwise behave like BEST.
+        EXACT
+    };
+
+    /// \brief Marks a buffer that stays live until the end of the program.
+    static const size_t end_of_program;
+
+    MemoryPlanner(size_t alignment = 1,
+                  strategy s = strategy::BEST,
+                  size_t exact_limit = default_exact_limit);
+
+    /// \brief Adds a buffer that is first written at program point first_use.
+    /// \returns A handle used to refer to the buffer in later calls.
+    size_t add_buffer(size_t size, size_t first_use, size_t last_use = end_of_program);
+
+    /// \brief Extends the lifetime of buffer up to and including program point last_use.
+    ///        The first call replaces the default end_of_program lifetime.
+    void set_last_use(size_t buffer, size_t last_use);
+
+    /// \brief Grows buffer so that it holds at least size bytes.
+    void grow(size_t buffer, size_t size);
+
+    /// \brief Assigns an offset to every buffer.
+    /// \returns The size of the pool needed to hold all buffers.
+    size_t plan();
+
+    size_t get_offset(size_t buffer) const;
+    size_t get_buffer_count() const { return m_buffers.size(); }
+    /// \brief Returns the pool size computed by the last call to plan().
+    size_t peak() const { return m_peak; }
+    /// \brief Returns the largest total size of simultaneously live buffers. No placement can
+    ///        use a smaller pool.
+    size_t lower_bound() const;
+
+    static const size_t default_exact_limit = 8;
+
+private:
+    struct buffer
+    {
+        size_t m_size;
+        size_t m_first_use;
+        size_t m_last_use;
+        bool m_last_use_set;
+    };
+
+    bool overlaps(size_t a, size_t b) const;
+    size_t find_offset(size_t b,
+                       std::vector<size_t>& conflicts,
+                       const std::vector<size_t>& offsets,
+                       bool best_fit) const;
+    size_t place(const std::vector<size_t>& order,
+                 bool best_fit,
+                 std::vector<size_t>& offsets) const;
+    void search(std::vector<size_t>& placed,
+                std::vector<bool>& is_placed,
+                std::vector<size_t>& offsets,
+                size_t current_peak,
+                size_t bound,
+                std::vector<size_t>& best_offsets,
+                size_t& best_peak) const;
+
+    std::vector<buffer> m_buffers;
+    std::vector<size_t> m_offsets;
+    size_t m_alignment;
+    strategy m_strategy;
+    size_t m_exact_limit;
+    size_t m_peak;
+};
@@ -0,0 +1,358 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Per-op memory effects, indexed by position in the function's current order
+    struct ScheduleGraph
+    {
+        vector<shared_ptr<Node>> ops;
+        vector<vector<size_t>> successors;
+        vector<vector<size_t>> predecessors;
+        vector<size_t> predecessor_counts;
+        vector<size_t> levels;
+        // bytes of temporaries an op writes
+        vector<int64_t> allocated;
+        // bytes of outputs nobody reads, released right after the op
+        vector<int64_t> dead;
+        // distinct temporaries an op reads
+        vector<vector<descriptor::Tensor*>> inputs;
+        // number of ops reading each temporary
+        unordered_map<descriptor::Tensor*, size_t> use_counts;
+    };
+
+    ScheduleGraph build_schedule_graph(const vector<shared_ptr<Node>>& ops)
+    {
+        ScheduleGraph g;
+        size_t count = ops.size();
+        g.ops = ops;
+        g.successors.resize(count);
+        g.predecessors.resize(count);
+        g.predecessor_counts.assign(count, 0);
+        g.levels.assign(count, 0);
+        g.allocated.assign(count, 0);
+        g.dead.assign(count, 0);
+        g.inputs.resize(count);
+
+        unordered_map<Node*, size_t> position;
+        for (size_t i = 0; i < count; i++)
+        {
+            position[ops[i].get()] = i;
+        }
+
+        // Parameters and constants are not pool allocated, and whatever feeds a Result has to
+        // survive until the end of the call.
+        unordered_set<descriptor::Tensor*> pinned;
+        for (auto& op : ops)
+        {
+            if (op->is_parameter() || op->is_constant())
+            {
+                for (auto& output : op->outputs())
+                {
+                    pinned.insert(&output.get_tensor());
+                }
+            }
+            else if (op->is_output())
+            {
+                for (auto& input : op->inputs())
+                {
+                    pinned.insert(&input.get_tensor());
+                }
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto& op = ops[i];
+            unordered_set<size_t> predecessors;
+            unordered_set<descriptor::Tensor*> inputs;
+            for (auto& input : op->inputs())
+            {
+                predecessors.insert(position.at(input.get_source_output().get_node()));
+                descriptor::Tensor* tensor = &input.get_tensor();
+                if (pinned.count(tensor) == 0 && inputs.insert(tensor).second)
+                {
+                    g.inputs[i].push_back(tensor);
+                    g.use_counts[tensor]++;
+                }
+            }
+            for (auto& cdep : op->get_control_dependencies())
+            {
+                predecessors.insert(position.at(cdep.get()));
+            }
+            for (size_t p : predecessors)
+            {
+                g.successors[p].push_back(i);
+                g.levels[i] = max(g.levels[i], g.levels[p] + 1);
+            }
+            g.predecessor_counts[i] = predecessors.size();
+            g.predecessors[i].assign(predecessors.begin(), predecessors.end());
+            sort(g.predecessors[i].begin(), g.predecessors[i].end());
+
+            if (!op->is_output())
+            {
+                for (auto& output : op->outputs())
+                {
+                    descriptor::Tensor* tensor = &output.get_tensor();
+                    if (pinned.count(tensor) == 0)
+                    {
+                        g.allocated[i] += tensor->size();
+                        if (output.get_target_inputs().empty())
+                        {
+                            g.dead[i] += tensor->size();
+                        }
+                    }
+                }
+            }
+        }
+        return g;
+    }
+
+    // Peak bytes of live temporaries when running g.ops in the given order
+    int64_t simulate(const ScheduleGraph& g, const vector<size_t>& order)
+    {
+        unordered_map<descriptor::Tensor*, size_t> remaining = g.use_counts;
+        int64_t live = 0;
+        int64_t peak = 0;
+        for (size_t i : order)
+        {
+            live += g.allocated[i];
+            peak = max(peak, live);
+            live -= g.dead[i];
+            for (descriptor::Tensor* tensor : g.inputs[i])
+            {
+                if (--remaining.at(tensor) == 0)
+                {
+                    live -= tensor->size();
+                }
+            }
+        }
+        return peak;
+    }
+
+    // Depth-first order from the results that, at every op, visits the argument needing the
+    // most extra memory first (Sethi-Ullman order). Sharing between branches is ignored when
+    // estimating requirements, so this is a heuristic on DAGs.
+    vector<size_t> sethi_ullman_order(const ScheduleGraph& g)
+    {
+        size_t count = g.ops.size();
+        // g.ops is topologically sorted, so predecessors are always computed first
+        vector<int64_t> requirement(count, 0);
+        auto by_requirement = [&](size_t a, size_t b) {
+            return requirement[a] - g.allocated[a] < requirement[b] - g.allocated[b];
+        };
+        for (size_t i = 0; i < count; i++)
+        {
+            vector<size_t> args = g.predecessors[i];
+            stable_sort(args.rbegin(), args.rend(), by_requirement);
+            int64_t held = 0;
+            for (size_t a : args)
+            {
+                requirement[i] = max(requirement[i], held + requirement[a]);
+                held += g.allocated[a];
+            }
+            requirement[i] = max(requirement[i], held + g.allocated[i]);
+        }
+
+        vector<size_t> order;
+        order.reserve(count);
+        vector<bool> done(count, false);
+        vector<size_t> stack;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (g.successors[i].empty())
+            {
+                stack.push_back(i);
+            }
+        }
+        while (!stack.empty())
+        {
+            size_t i = stack.back();
+            if (done[i])
+            {
+                stack.pop_back();
+                continue;
+            }
+            vector<size_t> todo;
+            for (size_t p : g.predecessors[i])
+            {
+                if (!done[p])
+                {
+                    todo.push_back(p);
+                }
+            }
+            if (todo.empty())
+            {
+                stack.pop_back();
+                done[i] = true;
+                order.push_back(i);
+            }
+            else
+            {
+                // the argument with the largest requirement ends up on top of the stack
+                stable_sort(todo.begin(), todo.end(), by_requirement);
+                stack.insert(stack.end(), todo.begin(), todo.end());
+            }
+        }
+        return order;
+    }
+
+    // Schedules ready ops one at a time, picking the eligible op with the smallest priority, or
+    // with minimize_growth the one that grows the live set the least.
+    vector<size_t> list_schedule(const ScheduleGraph& g,
+                                 const vector<size_t>& priorities,
+                                 bool minimize_growth,
+                                 size_t max_level_skew)
+    {
+        size_t count = g.ops.size();
+        vector<size_t> level_counts;
+        vector<size_t> ready;
+        vector<size_t> pending = g.predecessor_counts;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (g.levels[i] >= level_counts.size())
+            {
+                level_counts.resize(g.levels[i] + 1, 0);
+            }
+            level_counts[g.levels[i]]++;
+            if (pending[i] == 0)
+            {
+                ready.push_back(i);
+            }
+        }
+
+        unordered_map<descriptor::Tensor*, size_t> remaining = g.use_counts;
+        vector<size_t> schedule;
+        schedule.reserve(count);
+        size_t min_level = 0;
+        while (!ready.empty())
+        {
+            while (level_counts[min_level] == 0)
+            {
+                min_level++;
+            }
+
+            // The shallowest unscheduled op is always ready, so some op is always eligible
+            size_t best = ready.size();
+            pair<int64_t, size_t> best_key;
+            for (size_t r = 0; r < ready.size(); r++)
+            {
+                size_t i = ready[r];
+                if (g.levels[i] - min_level > max_level_skew)
+                {
+                    continue;
+                }
+                int64_t delta = 0;
+                if (minimize_growth)
+                {
+                    delta = g.allocated[i] - g.dead[i];
+                    for (descriptor::Tensor* tensor : g.inputs[i])
+                    {
+                        if (remaining.at(tensor) == 1)
+                        {
+                            delta -= tensor->size();
+                        }
+                    }
+                }
+                pair<int64_t, size_t> key{delta, priorities[i]};
+                if (best == ready.size() || key < best_key)
+                {
+                    best = r;
+                    best_key = key;
+                }
+            }
+
+            size_t i = ready[best];
+            ready[best] = ready.back();
+            ready.pop_back();
+            schedule.push_back(i);
+            level_counts[g.levels[i]]--;
+            for (descriptor::Tensor* tensor : g.inputs[i])
+            {
+                remaining.at(tensor)--;
+            }
+            for (size_t s : g.successors[i])
+            {
+                if (--pending[s] == 0)
+                {
+                    ready.push_back(s);
+                }
+            }
+        }
+        return schedule;
+    }
+}
+
+bool pass::MemorySchedule::run_on_function(shared_ptr<Function> function)
+{
+    ScheduleGraph g = build_schedule_graph(function->get_ordered_ops());
+    size_t count = g.ops.size();
+
+    vector<size_t> original(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        original[i] = i;
+    }
+    int64_t best_peak = simulate(g, original);
+    NGRAPH_DEBUG << "MemorySchedule: " << function->get_name() << " peak " << best_peak
+                 << " bytes in default order";
+
+    // Candidates: Sethi-Ullman order, and the op that grows the live set the least with
+    // Sethi-Ullman order breaking ties. Both are subject to the level skew bound.
+    vector<size_t> su_order = sethi_ullman_order(g);
+    vector<size_t> priorities(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        priorities[su_order[i]] = i;
+    }
+    vector<size_t> best;
+    for (bool minimize_growth : {false, true})
+    {
+        vector<size_t> schedule = list_schedule(g, priorities, minimize_growth, m_max_level_skew);
+        int64_t peak = simulate(g, schedule);
+        NGRAPH_DEBUG << "MemorySchedule: " << function->get_name() << " peak " << peak
+                     << " bytes " << (minimize_growth ? "minimizing growth" : "Sethi-Ullman");
+        if (peak < best_peak)
+        {
+            best_peak = peak;
+            best = move(schedule);
+        }
+    }
+
+    if (!best.empty())
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(count);
+        for (size_t i : best)
+        {
+            ordered_ops.push_back(g.ops[i]);
+        }
+        function->set_ordered_ops(ordered_ops);
+    }
+    return false;
+}
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <limits>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemorySchedule;
+    }
+}
+
+/// \brief Reorders independent branches of a function to reduce the peak size of live
+///        temporaries.
+///
+/// The default execution order is whatever depth-first order topological_sort produces. This
+/// pass list-schedules the ops instead, at each step running the ready op that grows the live
+/// set the least, and installs the result with Function::set_ordered_ops if its peak is lower.
+/// Run it before Liveness and MemoryLayout so that they plan memory for the new order.
+class ngraph::pass::MemorySchedule : public FunctionPass
+{
+public:
+    /// \param max_level_skew Limits how far the schedule may run ahead on one branch. An op
+    ///        whose dependency depth exceeds that of the shallowest unscheduled op by more than
+    ///        max_level_skew is held back. Zero keeps ops of equal depth, which could run
+    ///        concurrently, next to each other; the default leaves the order unconstrained.
+    MemorySchedule(size_t max_level_skew = std::numeric_limits<size_t>::max())
+        : FunctionPass()
+        , m_max_level_skew(max_level_skew)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+private:
+    size_t m_max_level_skew;
+};
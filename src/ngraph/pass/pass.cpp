@@ -14,8 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include "ngraph/pass/pass.hpp"
+#ifndef _WIN32
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+#include <typeinfo>
+
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/pass.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -40,6 +46,21 @@ bool pass::PassBase::get_property(const PassPropertyMask& prop) const
     return m_property.is_set(prop);
 }
 
+string pass::PassBase::get_name() const
+{
+    string name = typeid(*this).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
 void pass::PassBase::set_property(const PassPropertyMask& prop, bool value)
 {
     if (value)
@@ -69,6 +69,8 @@ public:
     virtual ~PassBase() {}
     /// Check if this pass has all the pass properties.
     bool get_property(const PassPropertyMask& prop_mask) const;
+    /// Demangled class name of the pass.
+    std::string get_name() const;
 
 protected:
     ManagerState& get_state();
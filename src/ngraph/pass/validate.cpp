@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+
 #include "ngraph/pass/validate.hpp"
 #include "ngraph/graph_util.hpp"
 
@@ -21,6 +23,16 @@ using namespace ngraph;
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    // Rewrites mark the nodes whose inputs they reconnect, so only those and whatever their
+    // new types propagate to need another round of type inference.
+    static const bool s_validate_all = std::getenv("NGRAPH_VALIDATE_ALL_NODES") != nullptr;
+    if (s_validate_all)
+    {
+        f->validate_nodes_and_infer_types();
+    }
+    else
+    {
+        f->revalidate_dirty_nodes();
+    }
     return false;
 }
@@ -89,7 +89,8 @@ namespace ngraph
                             training,
                             keep_prob,
                             vmsr,
-                            use_seed);
+                            use_seed,
+                            ectx->arena);
                     };
                 }
                 else if (args[0].get_element_type() == element::f64)
@@ -115,7 +116,8 @@ namespace ngraph
                             training,
                             keep_prob,
                             vmsr,
-                            use_seed);
+                            use_seed,
+                            ectx->arena);
                     };
                 }
                 else
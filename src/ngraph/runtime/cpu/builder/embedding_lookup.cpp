@@ -19,7 +19,7 @@
 
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -62,12 +62,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<float, float>(
+                            ngraph::runtime::cpu::kernel::embedding<float, float>(
                                 static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i32)
@@ -80,12 +81,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<float, int>(
+                            ngraph::runtime::cpu::kernel::embedding<float, int>(
                                 static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i64)
@@ -98,12 +100,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<float, int64_t>(
+                            ngraph::runtime::cpu::kernel::embedding<float, int64_t>(
                                 static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else
@@ -124,12 +127,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<double, float>(
+                            ngraph::runtime::cpu::kernel::embedding<double, float>(
                                 static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i32)
@@ -142,12 +146,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<double, int>(
+                            ngraph::runtime::cpu::kernel::embedding<double, int>(
                                 static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i64)
@@ -160,12 +165,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<double, int64_t>(
+                            ngraph::runtime::cpu::kernel::embedding<double, int64_t>(
                                 static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else
@@ -186,12 +192,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<int, float>(
+                            ngraph::runtime::cpu::kernel::embedding<int, float>(
                                 static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i32)
@@ -204,12 +211,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<int, int>(
+                            ngraph::runtime::cpu::kernel::embedding<int, int>(
                                 static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i64)
@@ -222,12 +230,13 @@ namespace ngraph
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<int, int64_t>(
+                            ngraph::runtime::cpu::kernel::embedding<int, int64_t>(
                                 static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else
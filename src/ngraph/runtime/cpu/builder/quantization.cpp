@@ -21,10 +21,9 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/quantize.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/reference/dequantize.hpp"
-#include "ngraph/runtime/reference/quantize.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -159,14 +158,15 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int8_t>(
+                                ngraph::runtime::cpu::kernel::dequantize<int8_t>(
                                     static_cast<int8_t*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
-                                    daxes);
+                                    daxes,
+                                    ectx->arena);
                             };
                         }
                         else if (out[0].get_element_type() == element::f64)
@@ -180,14 +180,15 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int8_t>(
+                                ngraph::runtime::cpu::kernel::dequantize<int8_t>(
                                     static_cast<int8_t*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
-                                    daxes);
+                                    daxes,
+                                    ectx->arena);
                             };
                         }
                         else
@@ -208,14 +209,15 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<uint8_t>(
+                                ngraph::runtime::cpu::kernel::dequantize<uint8_t>(
                                     static_cast<uint8_t*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
-                                    daxes);
+                                    daxes,
+                                    ectx->arena);
                             };
                         }
                         else if (out[0].get_element_type() == element::f64)
@@ -229,14 +231,15 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<uint8_t>(
+                                ngraph::runtime::cpu::kernel::dequantize<uint8_t>(
                                     static_cast<uint8_t*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
-                                    daxes);
+                                    daxes,
+                                    ectx->arena);
                             };
                         }
                         else
@@ -257,14 +260,15 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int32_t>(
+                                ngraph::runtime::cpu::kernel::dequantize<int32_t>(
                                     static_cast<int32_t*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
-                                    daxes);
+                                    daxes,
+                                    ectx->arena);
                             };
                         }
                         else if (out[0].get_element_type() == element::f64)
@@ -278,14 +282,15 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int32_t>(
+                                ngraph::runtime::cpu::kernel::dequantize<int32_t>(
                                     static_cast<int32_t*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
-                                    daxes);
+                                    daxes,
+                                    ectx->arena);
                             };
                         }
                         else
@@ -436,7 +441,7 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<float>(
+                                ngraph::runtime::cpu::kernel::quantize<float>(
                                     static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
@@ -444,7 +449,8 @@ namespace ngraph
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
-                                    round_mode);
+                                    round_mode,
+                                    ectx->arena);
                             };
                         }
                         else if (out[0].get_element_type() == element::u8)
@@ -459,7 +465,7 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<float>(
+                                ngraph::runtime::cpu::kernel::quantize<float>(
                                     static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
@@ -467,7 +473,8 @@ namespace ngraph
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
-                                    round_mode);
+                                    round_mode,
+                                    ectx->arena);
                             };
                         }
                         else if (out[0].get_element_type() == element::i32)
@@ -482,7 +489,7 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<float>(
+                                ngraph::runtime::cpu::kernel::quantize<float>(
                                     static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
@@ -490,7 +497,8 @@ namespace ngraph
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
-                                    round_mode);
+                                    round_mode,
+                                    ectx->arena);
                             };
                         }
                         else
@@ -512,7 +520,7 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<double>(
+                                ngraph::runtime::cpu::kernel::quantize<double>(
                                     static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
@@ -520,7 +528,8 @@ namespace ngraph
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
-                                    round_mode);
+                                    round_mode,
+                                    ectx->arena);
                             };
                         }
                         else if (out[0].get_element_type() == element::u8)
@@ -535,7 +544,7 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<double>(
+                                ngraph::runtime::cpu::kernel::quantize<double>(
                                     static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
@@ -543,7 +552,8 @@ namespace ngraph
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
-                                    round_mode);
+                                    round_mode,
+                                    ectx->arena);
                             };
                         }
                         else if (out[0].get_element_type() == element::i32)
@@ -558,7 +568,7 @@ namespace ngraph
                                        arg2_buffer_index,
                                        out_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<double>(
+                                ngraph::runtime::cpu::kernel::quantize<double>(
                                     static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
                                     static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                     static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
@@ -566,7 +576,8 @@ namespace ngraph
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
-                                    round_mode);
+                                    round_mode,
+                                    ectx->arena);
                             };
                         }
                         else
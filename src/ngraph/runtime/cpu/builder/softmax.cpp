@@ -19,7 +19,6 @@
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/reference/softmax.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -88,78 +87,14 @@ namespace ngraph
                         };
                         functors.emplace_back(functor);
                     }
-                    else if (axes.size() == 1)
-                    {
-                        if (*axes.begin() == (arg_shape.size() - 1))
-                        {
-                            std::function<decltype(
-                                runtime::cpu::kernel::softmax_innermost_1rd<float, 1>)>
-                                kernel;
-
-                            PARTIAL_SELECT_KERNEL_BY_RANK(
-                                kernel,
-                                args[0].get_element_type(),
-                                args[0].get_shape().size(),
-                                runtime::cpu::kernel::softmax_innermost_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                        }
-                        else
-                        {
-                            std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)>
-                                kernel;
-
-                            PARTIAL_SELECT_KERNEL_BY_RANK(kernel,
-                                                          args[0].get_element_type(),
-                                                          args[0].get_shape().size(),
-                                                          runtime::cpu::kernel::softmax_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           axes,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                        }
-                    }
-                    else if (arg_shape.size() == 3 && axes.size() == 2)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::softmax_3d_2rd<float>)> kernel;
-
-                        SELECT_KERNEL(kernel,
-                                      args[0].get_element_type(),
-                                      runtime::cpu::kernel::softmax_3d_2rd);
-
-                        auto functor =
-                            [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                kernel(ctx->buffer_data[arg_buffer_index],
-                                       ctx->buffer_data[out_buffer_index],
-                                       arg_shape,
-                                       axes,
-                                       ectx->arena);
-                            };
-                        functors.emplace_back(functor);
-                    }
-                    else if (arg_shape.size() == 4 && axes.size() == 3)
+                    else
                     {
-                        std::function<decltype(runtime::cpu::kernel::softmax_4d_3rd<float>)> kernel;
+                        std::function<decltype(runtime::cpu::kernel::softmax_strided<float>)>
+                            kernel;
 
                         SELECT_KERNEL(kernel,
                                       args[0].get_element_type(),
-                                      runtime::cpu::kernel::softmax_4d_3rd);
+                                      runtime::cpu::kernel::softmax_strided);
 
                         auto functor =
                             [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
@@ -172,26 +107,6 @@ namespace ngraph
                             };
                         functors.emplace_back(functor);
                     }
-                    else if (softmax->get_element_type() == element::f32)
-                    {
-                        NGRAPH_WARN << "Falling back to refernce kernel for softmax " << arg_shape
-                                    << " over " << axes;
-                        auto functor = [&, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            runtime::reference::softmax<float>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                arg_shape,
-                                axes);
-                        };
-                        functors.emplace_back(functor);
-                    }
-                    else
-                    {
-                        NGRAPH_ERR << "Unsupported Softmax " << arg_shape << " over " << axes
-                                   << " in cpu buiilder";
-                        throw ngraph_error("Unsupported Softmax");
-                    }
                 }
             }
 
@@ -18,7 +18,7 @@
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -49,7 +49,6 @@ namespace ngraph
                 bool is_int64 = out[0].get_element_type() == element::i64;
                 auto axis = topk->get_top_k_axis();
                 auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
                 auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
 
@@ -60,7 +59,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -68,22 +66,21 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
+                            ngraph::runtime::cpu::kernel::topk<float, int64_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                     else
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -91,15 +88,15 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
+                            ngraph::runtime::cpu::kernel::topk<float, int32_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                 }
@@ -109,7 +106,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -117,22 +113,21 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
+                            ngraph::runtime::cpu::kernel::topk<double, int64_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                     else
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -140,15 +135,15 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
+                            ngraph::runtime::cpu::kernel::topk<double, int32_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                 }
@@ -158,7 +153,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -166,22 +160,21 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<int32_t, int64_t>(
+                            ngraph::runtime::cpu::kernel::topk<int32_t, int64_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                     else
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -189,15 +182,15 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<int32_t, int32_t>(
+                            ngraph::runtime::cpu::kernel::topk<int32_t, int32_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
-                                compute_max);
+                                compute_max,
+                                ectx->arena);
                         };
                     }
                 }
@@ -23,6 +23,7 @@
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
@@ -146,8 +147,29 @@ shared_ptr<runtime::Executable>
             return rc;
         }
     }
-    rc = make_shared<CPU_Executable>(
-        func, pass_config, get_host_memory_allocator(), performance_counters_enabled);
+    shared_ptr<executor::CPUExecutor> cpu_executor;
+    {
+        std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        if (m_intra_op_parallelism > 0 || m_inter_op_parallelism > 0 || !m_cpu_affinity.empty())
+        {
+            int num_thread_pools = max(1, m_inter_op_parallelism);
+            int num_threads_per_pool = m_intra_op_parallelism;
+            if (num_threads_per_pool == 0)
+            {
+                num_threads_per_pool =
+                    m_cpu_affinity.empty()
+                        ? executor::GetCPUExecutor().get_num_cores()
+                        : max(1, static_cast<int>(m_cpu_affinity.size()) / num_thread_pools);
+            }
+            cpu_executor = make_shared<executor::CPUExecutor>(
+                num_thread_pools, num_threads_per_pool, m_cpu_affinity);
+        }
+    }
+    rc = make_shared<CPU_Executable>(func,
+                                     pass_config,
+                                     get_host_memory_allocator(),
+                                     performance_counters_enabled,
+                                     cpu_executor);
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
         m_exec_map.insert({func, rc});
@@ -158,19 +180,30 @@ shared_ptr<runtime::Executable>
 runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              ngraph::pass::PassConfig& pass_config,
                                              Allocator* allocator,
-                                             bool performance_counters_enabled)
+                                             bool performance_counters_enabled,
+                                             shared_ptr<executor::CPUExecutor> cpu_executor)
+    : m_cpu_executor(cpu_executor)
 {
     FunctionInstance& instance = m_function_instance;
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
+        instance.m_external_function->set_cpu_executor(m_cpu_executor);
+        // Kernels query the executor while they are built
+        executor::CPUExecutorScope executor_scope(m_cpu_executor.get());
         auto cf = instance.m_external_function->make_call_frame(pass_config, allocator);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
     set_parameters_and_results(*func);
 }
 
+runtime::cpu::CPU_Executable::~CPU_Executable()
+{
+    // Tasks on the shared executor arena reference this object
+    wait_for_async_calls();
+}
+
 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executable::get_call_frame()
 {
     FunctionInstance& instance = m_function_instance;
@@ -194,6 +227,95 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
     return rc;
 }
 
+void runtime::cpu::CPU_Executable::bind(const vector<void*>& outputs,
+                                        const vector<void*>& inputs)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before bind().");
+    }
+    instance.m_call_frame->bind(outputs, inputs);
+}
+
+void runtime::cpu::CPU_Executable::call_bound()
+{
+    m_function_instance.m_call_frame->call_bound();
+}
+
+void runtime::cpu::CPU_Executable::dispatch_async(std::function<void()> task)
+{
+    executor::CPUExecutorScope executor_scope(m_cpu_executor.get());
+    executor::GetCPUExecutor().execute_async(std::move(task));
+}
+
+size_t runtime::cpu::CPU_Executable::get_max_async_calls() const
+{
+    const FunctionInstance& instance = m_function_instance;
+    return instance.m_call_frame == nullptr ? 1 : instance.m_call_frame->get_num_contexts();
+}
+
+bool runtime::cpu::CPU_Backend::set_config(const map<string, string>& config, string& error)
+{
+    int intra_op_parallelism;
+    int inter_op_parallelism;
+    vector<int> cpu_affinity;
+    {
+        std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        intra_op_parallelism = m_intra_op_parallelism;
+        inter_op_parallelism = m_inter_op_parallelism;
+        cpu_affinity = m_cpu_affinity;
+    }
+    error = "";
+    for (auto& entry : config)
+    {
+        if (entry.first == "intra_op_parallelism" || entry.first == "inter_op_parallelism")
+        {
+            int value = atoi(entry.second.c_str());
+            if (value < 1)
+            {
+                error = "Invalid value for " + entry.first + ": " + entry.second;
+                return false;
+            }
+            if (entry.first == "intra_op_parallelism")
+            {
+                intra_op_parallelism = value;
+            }
+            else
+            {
+                inter_op_parallelism = value;
+            }
+        }
+        else if (entry.first == "cpu_affinity")
+        {
+            try
+            {
+                cpu_affinity = executor::ParseCPUList(entry.second);
+            }
+            catch (const ngraph_error&)
+            {
+                cpu_affinity.clear();
+            }
+            if (cpu_affinity.empty())
+            {
+                error = "Invalid value for cpu_affinity: " + entry.second;
+                return false;
+            }
+        }
+        else
+        {
+            error = "Unsupported CPU backend config: " + entry.first;
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+    m_intra_op_parallelism = intra_op_parallelism;
+    m_inter_op_parallelism = inter_op_parallelism;
+    m_cpu_affinity = cpu_affinity;
+    return true;
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
@@ -34,6 +34,10 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            namespace executor
+            {
+                class CPUExecutor;
+            }
             BackendConstructor* get_backend_constructor_pointer();
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
@@ -71,6 +75,14 @@ namespace ngraph
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
+                /// \brief Give executables compiled after this call their own thread pools.
+                ///        Supported keys are "intra_op_parallelism" (threads per pool),
+                ///        "inter_op_parallelism" (number of pools) and "cpu_affinity" (a CPU
+                ///        list such as "0-3,8" the threads are pinned to). Executables compiled
+                ///        earlier keep their executor.
+                bool set_config(const std::map<std::string, std::string>& config,
+                                std::string& error) override;
+
             private:
                 // this mutex will be used to protect the addition and deletion
                 // of function to m_exec_map across multiple threads
@@ -78,6 +90,10 @@ namespace ngraph
                 std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<Executable>>
                     m_exec_map;
                 Allocator* m_allocator;
+                // Executor settings from set_config, protected by m_exec_map_mutex
+                int m_intra_op_parallelism = 0;
+                int m_inter_op_parallelism = 0;
+                std::vector<int> m_cpu_affinity;
             };
 
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
@@ -86,14 +102,38 @@ namespace ngraph
                 CPU_Executable(std::shared_ptr<Function> func,
                                ngraph::pass::PassConfig& pass_config,
                                Allocator* allocator,
-                               bool performance_counters_enabled);
+                               bool performance_counters_enabled,
+                               std::shared_ptr<executor::CPUExecutor> cpu_executor = nullptr);
+                ~CPU_Executable() override;
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Bind raw host buffers once for repeated call_bound() invocations.
+                ///        Buffers use the layouts of the parameter and result layout
+                ///        descriptors, which are native row-major unless the function was
+                ///        compiled to accept or produce MKLDNN layouts.
+                void bind(const std::vector<void*>& outputs, const std::vector<void*>& inputs);
+
+                /// \brief Invoke the Executable on the buffers given to bind() without
+                ///        per-call tensor unwrapping or layout propagation.
+                void call_bound();
+                /// \brief Returns the dedicated executor of this Executable, or nullptr if it
+                ///        runs on the process wide executor
+                const std::shared_ptr<executor::CPUExecutor>& get_cpu_executor() const
+                {
+                    return m_cpu_executor;
+                }
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+            protected:
+                // Asynchronous calls run on the CPU executor's arena, one per runtime context,
+                // so staging for one request overlaps with compute of another.
+                void dispatch_async(std::function<void()> task) override;
+                size_t get_max_async_calls() const override;
+
             private:
                 class FunctionInstance
                 {
@@ -102,6 +142,9 @@ namespace ngraph
                     std::shared_ptr<CPU_CallFrame> m_call_frame = nullptr;
                     bool m_performance_counters_enabled = false;
                 } m_function_instance;
+
+                // Dedicated executor from CPU_Backend::set_config, null for the process wide one
+                std::shared_ptr<executor::CPUExecutor> m_cpu_executor;
             };
         }
     }
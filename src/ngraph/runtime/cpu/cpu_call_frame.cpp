@@ -15,10 +15,12 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <thread>
 
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
@@ -75,20 +77,24 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     vector<void*> inputs;
     vector<void*> outputs;
 
+    auto& ctx_input_generation = m_ctx_input_generation[id];
+    auto& ctx_input_ptr = m_ctx_input_ptr[id];
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
-        if (disable_caching)
-        {
-            m_ctx_vec[id]->p_en[i] = true;
-        }
-        else
-        {
-            m_ctx_vec[id]->p_en[i] = tv->get_stale();
-        }
+        void* data_ptr = tv->get_data_ptr();
+
+        // An input has to be reloaded if it was marked stale by any call since this context
+        // last ran, or if a different buffer is bound to it.
+        uint64_t generation =
+            tv->get_stale() ? ++m_input_generation[i] : m_input_generation[i].load();
+        m_ctx_vec[id]->p_en[i] = disable_caching || generation != ctx_input_generation[i] ||
+                                 data_ptr != ctx_input_ptr[i];
+        ctx_input_generation[i] = generation;
+        ctx_input_ptr[i] = data_ptr;
 
-        inputs.push_back(tv->get_data_ptr());
+        inputs.push_back(data_ptr);
     }
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
@@ -97,6 +103,13 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    execute(id, inputs, outputs);
+}
+
+void runtime::cpu::CPU_CallFrame::execute(size_t id,
+                                          std::vector<void*>& inputs,
+                                          std::vector<void*>& outputs)
+{
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -115,48 +128,129 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     }
 }
 
+void runtime::cpu::CPU_CallFrame::bind(const std::vector<void*>& outputs,
+                                       const std::vector<void*>& inputs)
+{
+    if (inputs.size() != m_external_function->get_parameter_layout_descriptors().size() ||
+        outputs.size() != m_external_function->get_result_layout_descriptors().size())
+    {
+        throw ngraph_error("Error binding buffers - buffer counts do not match the function");
+    }
+    m_bound_inputs = inputs;
+    m_bound_outputs = outputs;
+    m_is_bound = true;
+}
+
+void runtime::cpu::CPU_CallFrame::call_bound()
+{
+    if (!m_is_bound)
+    {
+        throw ngraph_error("call_bound() requires buffers bound with bind()");
+    }
+
+    auto id = acquire_context();
+    auto ctx = m_ctx_vec[id];
+
+    try
+    {
+        ctx->pc = 0;
+        // Raw buffers carry no staleness information, every input is treated as modified.
+        // Forget the last consumed buffers so the next call() reloads its inputs as well.
+        std::fill(ctx->p_en, ctx->p_en + m_bound_inputs.size(), true);
+        std::fill(m_ctx_input_ptr[id].begin(), m_ctx_input_ptr[id].end(), nullptr);
+        execute(id, m_bound_inputs, m_bound_outputs);
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+
+    release_context(id);
+}
+
 void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    auto id = 0;
-    auto disable_caching = false;
+    auto id = acquire_context();
+
+    try
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
-        {
-            m_cv.wait(lck);
-        }
+        m_ctx_vec[id]->pc = 0;
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+        inner_call(output_tvs, input_tvs, id, false);
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+
+    release_context(id);
+}
 
-        for (auto i = 0; i < m_num_ctx; i++)
+bool runtime::cpu::CPU_CallFrame::try_pop_context(size_t& id)
+{
+    uint64_t head = m_free_head.load();
+    while (true)
+    {
+        uint32_t top = static_cast<uint32_t>(head);
+        if (top == 0)
         {
-            if (m_id_pool[i])
-            {
-                id = i;
-                break;
-            }
+            return false;
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        uint64_t next = m_free_next[top - 1].load(std::memory_order_relaxed);
+        uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+        if (m_free_head.compare_exchange_weak(head, new_head))
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            id = top - 1;
+            return true;
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
     }
+}
+
+void runtime::cpu::CPU_CallFrame::push_context(size_t id)
+{
+    uint64_t head = m_free_head.load();
+    uint64_t new_head;
+    do
+    {
+        m_free_next[id].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        new_head = (((head >> 32) + 1) << 32) | (id + 1);
+    } while (!m_free_head.compare_exchange_weak(head, new_head));
+}
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+size_t runtime::cpu::CPU_CallFrame::acquire_context()
+{
+    size_t id;
+    if (try_pop_context(id))
+    {
+        return id;
+    }
 
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+    // All contexts are busy; sleep until one is released.
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_num_waiters++;
+    while (!try_pop_context(id))
+    {
+        m_cv.wait(lck);
+    }
+    m_num_waiters--;
+    return id;
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    push_context(id);
+    if (m_num_waiters.load() > 0)
+    {
+        // Taking the lock orders this notification after the waiter's failed pop.
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+        }
+        m_cv.notify_one();
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -181,19 +275,33 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
 
 void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 {
+    auto num_inputs = m_external_function->get_parameter_layout_descriptors().size();
+    m_input_generation.reset(new std::atomic<uint64_t>[num_inputs]);
+    for (size_t i = 0; i < num_inputs; i++)
+    {
+        m_input_generation[i] = 0;
+    }
+    m_free_next.reset(new std::atomic<uint32_t>[m_num_ctx]);
+
     for (auto i = 0; i < m_num_ctx; i++)
     {
-        m_id_pool[i] = true;
         auto ctx = new CPURuntimeContext;
         m_ctx_vec.push_back(ctx);
 
         ctx->pc = 0;
+        auto& cpu_executor = executor::GetCPUExecutor();
+        // With NUMA awareness, contexts are spread over the thread pools and their buffers
+        // are placed on the NUMA node of their thread pool
+        ctx->arena = cpu_executor.is_numa_aware() ? i % cpu_executor.get_num_thread_pools() : 0;
         ctx->op_durations = nullptr;
         if (runtime::cpu::IsTracingEnabled())
         {
             ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
         }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+        ctx->p_en = new bool[num_inputs];
+        ctx->tensor_stale = new bool[m_external_function->get_stale_flag_count()]();
+        m_ctx_input_generation.emplace_back(num_inputs, std::numeric_limits<uint64_t>::max());
+        m_ctx_input_ptr.emplace_back(num_inputs, nullptr);
 
         ctx->first_iteration = true;
 
@@ -204,6 +312,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
         {
             auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
+            cpu_executor.bind_memory(buffer->get_ptr(), buffer_size, ctx->arena);
             ctx->memory_buffers.push_back(buffer);
         }
         const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
@@ -233,7 +342,12 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
                 new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
         }
     }
-    m_num_ctx_available = m_num_ctx;
+
+    // Push in reverse so that context 0 is handed out first.
+    for (size_t i = m_num_ctx; i > 0; i--)
+    {
+        push_context(i - 1);
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
@@ -245,6 +359,7 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 
         delete[] ctx->op_durations;
         delete[] ctx->p_en;
+        delete[] ctx->tensor_stale;
         for (auto p : ctx->mkldnn_primitives)
         {
             delete p;
@@ -275,5 +390,7 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         }
         delete ctx;
     }
-    m_num_ctx_available = 0;
+    m_free_head = 0;
+    m_ctx_input_generation.clear();
+    m_ctx_input_ptr.clear();
 }
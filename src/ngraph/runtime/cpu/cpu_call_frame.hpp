@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -70,9 +72,23 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Bind raw host buffers for call_bound(). Input buffers must use the
+                ///        layouts of the function's parameter layout descriptors and output
+                ///        buffers receive results in the result layout descriptors' layouts.
+                ///        The buffers must stay valid until they are rebound.
+                void bind(const std::vector<void*>& outputs, const std::vector<void*>& inputs);
+
+                /// \brief Invoke the function on the buffers passed to bind(). Skips tensor
+                ///        unwrapping and layout propagation; calls that run concurrently on
+                ///        the same bound outputs race with each other.
+                void call_bound();
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
+                /// \returns the number of runtime contexts, i.e. how many calls may run
+                ///          concurrently on this call frame
+                size_t get_num_contexts() const { return m_num_ctx; }
                 void setup_runtime_context(runtime::Allocator* allocator);
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
@@ -82,21 +98,49 @@ namespace ngraph
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
                 CPU_CallFrame& operator=(const CPU_CallFrame&) = delete;
 
+                void execute(size_t id, std::vector<void*>& inputs, std::vector<void*>& outputs);
+
                 void inner_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                /// \brief Take a free runtime context off the lock-free free-list, blocking
+                ///        only when every context is in use.
+                size_t acquire_context();
+                /// \brief Return a runtime context to the free-list.
+                void release_context(size_t id);
+                bool try_pop_context(size_t& id);
+                void push_context(size_t id);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
-                std::mutex m_mutex;
-                std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
                 size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
+                // Free-list of context ids (Treiber stack). The low 32 bits of the head hold
+                // the index of the top context plus one (zero when empty), the high 32 bits a
+                // tag that is bumped on every update to rule out ABA.
+                std::atomic<uint64_t> m_free_head{0};
+                std::unique_ptr<std::atomic<uint32_t>[]> m_free_next;
+
+                // Only used when all contexts are busy.
+                std::mutex m_mutex;
+                std::condition_variable m_cv;
+                std::atomic<size_t> m_num_waiters{0};
+
+                // Number of calls in which each input was marked stale. Every context remembers
+                // the generation and buffer of each input it last consumed, so staleness hints
+                // stay valid when consecutive calls land on different contexts.
+                std::unique_ptr<std::atomic<uint64_t>[]> m_input_generation;
+                std::vector<std::vector<uint64_t>> m_ctx_input_generation;
+                std::vector<std::vector<void*>> m_ctx_input_ptr;
+
+                // Buffers for call_bound()
+                std::vector<void*> m_bound_inputs;
+                std::vector<void*> m_bound_outputs;
+                bool m_is_bound = false;
+
                 // Codegen specific
 
                 /// Function that initializes the context used in codegen mode.
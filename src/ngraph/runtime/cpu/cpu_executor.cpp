@@ -14,11 +14,30 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <sstream>
 #include <thread>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "cpu_executor.hpp"
 
+#include "tbb/global_control.h"
+
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 
 #define MAX_PARALLELISM_THRESHOLD 2
 
@@ -67,6 +86,111 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+namespace
+{
+    // Every CPUExecutor in the process takes its threads out of one budget. Dispatch threads
+    // run asynchronous calls and TBB flow graphs, which together are capped to the dispatch
+    // threads of all executors.
+    struct ThreadAccounting
+    {
+        std::mutex mutex;
+        int budget = ngraph::runtime::cpu::executor::GetThreadBudget();
+        int in_use = 0;
+        int dispatch_in_use = 0;
+        std::unique_ptr<tbb::global_control> tbb_control;
+    };
+
+    // Function local so that it outlives the process wide executor
+    ThreadAccounting& GetThreadAccounting()
+    {
+        static ThreadAccounting accounting;
+        return accounting;
+    }
+
+    // Takes up to `requested` threads out of the budget, but no less than `minimum` even
+    // when the budget is used up
+    int ReserveThreads(int requested, int minimum, bool dispatch)
+    {
+        auto& accounting = GetThreadAccounting();
+        std::lock_guard<std::mutex> lock(accounting.mutex);
+        int granted =
+            std::max(minimum, std::min(requested, accounting.budget - accounting.in_use));
+        accounting.in_use += granted;
+        if (dispatch)
+        {
+            accounting.dispatch_in_use += granted;
+            accounting.tbb_control.reset();
+            accounting.tbb_control.reset(new tbb::global_control(
+                tbb::global_control::max_allowed_parallelism, accounting.dispatch_in_use + 1));
+        }
+        return granted;
+    }
+
+    void ReleaseThreads(int count, bool dispatch)
+    {
+        auto& accounting = GetThreadAccounting();
+        std::lock_guard<std::mutex> lock(accounting.mutex);
+        accounting.in_use -= count;
+        if (dispatch)
+        {
+            accounting.dispatch_in_use -= count;
+            accounting.tbb_control.reset();
+            if (accounting.dispatch_in_use > 0)
+            {
+                accounting.tbb_control.reset(
+                    new tbb::global_control(tbb::global_control::max_allowed_parallelism,
+                                            accounting.dispatch_in_use + 1));
+            }
+        }
+    }
+
+    // Decrements the caller count of a thread pool when a kernel finishes or throws
+    class PoolCaller
+    {
+    public:
+        explicit PoolCaller(std::atomic<int>& callers)
+            : m_callers(callers)
+            , m_count(++callers)
+        {
+        }
+        ~PoolCaller() { m_callers--; }
+        int get_count() const { return m_count; }
+
+    private:
+        std::atomic<int>& m_callers;
+        int m_count;
+    };
+}
+
+// Pin every thread of the pool to the given CPUs. Each pinning task blocks until all of them
+// are running so that every pool thread executes exactly one.
+static void PinThreadPool(Eigen::ThreadPool& pool, int num_threads, const std::vector<int>& cpus)
+{
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus)
+    {
+        CPU_SET(cpu, &cpu_set);
+    }
+    std::atomic<int> arrived{0};
+    Eigen::Barrier done(static_cast<unsigned int>(num_threads));
+    for (int i = 0; i < num_threads; i++)
+    {
+        pool.Schedule([&]() {
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+            arrived++;
+            while (arrived.load() < num_threads)
+            {
+                std::this_thread::yield();
+            }
+            done.Notify();
+        });
+    }
+    done.Wait();
+#endif
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -79,45 +203,132 @@ namespace ngraph
                     : m_num_thread_pools(num_thread_pools)
                 {
                     m_num_cores = GetNumCores();
-                    for (int i = 0; i < num_thread_pools; i++)
+                    m_thread_budget = GetThreadAccounting().budget;
+                    std::vector<std::pair<int, std::vector<int>>> numa_nodes;
+#ifdef __linux__
+                    if (std::getenv("NGRAPH_CPU_NUMA_AWARE") != nullptr)
+                    {
+                        numa_nodes = GetNUMANodes("/sys/devices/system/node");
+                    }
+#endif
+                    m_numa_aware = numa_nodes.size() > 1;
+                    if (m_numa_aware)
                     {
-                        int num_threads_per_pool;
+                        m_numa_pools = AssignNUMANodes(num_thread_pools, numa_nodes);
+                    }
 
-                        // Eigen threadpool will still be used for reductions
-                        // and other tensor operations that dont use a parallelFor
-                        num_threads_per_pool = GetNumCores();
+                    // Eigen threadpool will still be used for reductions
+                    // and other tensor operations that dont use a parallelFor
+                    int num_threads_per_pool = GetNumCores();
 
-                        // User override
-                        char* eigen_tp_count = std::getenv("NGRAPH_CPU_EIGEN_THREAD_COUNT");
-                        if (eigen_tp_count != nullptr)
+                    // User override
+                    char* eigen_tp_count = std::getenv("NGRAPH_CPU_EIGEN_THREAD_COUNT");
+                    if (eigen_tp_count != nullptr)
+                    {
+                        const int tp_count = std::atoi(eigen_tp_count);
+                        if (tp_count < 1 || tp_count > GetNumCores())
                         {
-                            const int tp_count = std::atoi(eigen_tp_count);
-                            if (tp_count < 1 || tp_count > GetNumCores())
-                            {
-                                throw ngraph_error(
-                                    "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
-                                    "(" +
-                                    std::string(eigen_tp_count) +
-                                    "). Please specify a value in range [1-" +
-                                    std::to_string(GetNumCores()) + "]");
-                            }
-                            num_threads_per_pool = tp_count;
+                            throw ngraph_error(
+                                "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
+                                "(" +
+                                std::string(eigen_tp_count) +
+                                "). Please specify a value in range [1-" +
+                                std::to_string(GetNumCores()) + "]");
                         }
+                        num_threads_per_pool = tp_count;
+                    }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
-                        m_thread_pool_devices.push_back(
-                            std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
-                                m_thread_pools[i].get(), num_threads_per_pool)));
-                        m_tbb_arenas.emplace_back(1);
+                    reserve_threads(num_threads_per_pool);
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
+                        add_thread_pool(m_num_threads_per_pool,
+                                        m_numa_aware ? m_numa_pools[i].second
+                                                     : std::vector<int>());
+                    }
+                    if (num_thread_pools > 1)
+                    {
+                        m_inter_op_scheduler.reset(new InterOpScheduler(num_thread_pools));
                     }
                 }
 
+                CPUExecutor::CPUExecutor(int num_thread_pools,
+                                         int num_threads_per_pool,
+                                         const std::vector<int>& cpus)
+                    : m_num_thread_pools(num_thread_pools)
+                    , m_num_cores(num_threads_per_pool)
+                    , m_thread_budget(GetThreadAccounting().budget)
+                    , m_numa_aware(false)
+                {
+                    NGRAPH_CHECK(num_thread_pools > 0 && num_threads_per_pool > 0,
+                                 "CPU executor needs at least one thread pool and thread");
+                    reserve_threads(num_threads_per_pool);
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
+                        add_thread_pool(m_num_threads_per_pool, cpus);
+                    }
+                    if (num_thread_pools > 1)
+                    {
+                        m_inter_op_scheduler.reset(new InterOpScheduler(num_thread_pools));
+                    }
+                }
+
+                CPUExecutor::~CPUExecutor()
+                {
+                    ReleaseThreads(m_num_thread_pools * m_num_threads_per_pool, false);
+                    ReleaseThreads(m_num_dispatch_threads, true);
+                }
+
+                void CPUExecutor::reserve_threads(int num_threads_per_pool)
+                {
+                    // Every pool keeps at least one thread when the budget is used up
+                    int pool_threads = ReserveThreads(
+                        m_num_thread_pools * num_threads_per_pool, m_num_thread_pools, false);
+                    m_num_threads_per_pool = pool_threads / m_num_thread_pools;
+                    ReleaseThreads(pool_threads - m_num_thread_pools * m_num_threads_per_pool,
+                                   false);
+                    // Asynchronous calls and flow graphs mostly wait for the thread pools, one
+                    // dispatch thread per pool keeps every pool busy
+                    m_num_dispatch_threads = ReserveThreads(m_num_thread_pools, 1, true);
+                    m_async_arena.initialize(m_num_dispatch_threads, 0);
+                    m_pool_callers.reset(new std::atomic<int>[m_num_thread_pools]);
+                    for (int i = 0; i < m_num_thread_pools; i++)
+                    {
+                        m_pool_callers[i] = 0;
+                    }
+                }
+
+                void CPUExecutor::add_thread_pool(int num_threads, const std::vector<int>& cpus)
+                {
+                    m_thread_pools.push_back(
+                        std::unique_ptr<Eigen::ThreadPool>(new Eigen::ThreadPool(num_threads)));
+                    if (!cpus.empty())
+                    {
+                        PinThreadPool(*m_thread_pools.back(), num_threads, cpus);
+                    }
+                    m_thread_pool_devices.push_back(
+                        std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
+                            m_thread_pools.back().get(), num_threads)));
+                    m_tbb_arenas.emplace_back(1);
+                }
+
                 void CPUExecutor::execute(CPUKernelFunctor& f,
                                           CPURuntimeContext* ctx,
                                           CPUExecutionContext* ectx,
                                           bool use_tbb)
                 {
+                    PoolCaller caller(m_pool_callers[ectx->arena]);
+#ifdef _OPENMP
+                    // MKLDNN and the remaining OpenMP kernels size their teams per calling
+                    // thread. Threads running kernels on the same pool at once split the
+                    // threads of that pool between their teams.
+                    int team_size = std::max(1, m_num_threads_per_pool / caller.get_count());
+                    static thread_local int omp_num_threads = 0;
+                    if (omp_num_threads != team_size)
+                    {
+                        omp_set_num_threads(team_size);
+                        omp_num_threads = team_size;
+                    }
+#endif
                     auto tbb_functor = [&]() { f(ctx, ectx); };
                     if (use_tbb)
                     {
@@ -129,8 +340,201 @@ namespace ngraph
                     }
                 }
 
+                void CPUExecutor::bind_memory(void* ptr, size_t size, int id)
+                {
+#ifdef __linux__
+                    // Pools spanning several nodes keep the default first-touch policy
+                    if (get_numa_node(id) < 0)
+                    {
+                        return;
+                    }
+                    // mbind works on whole pages, leave partial pages at either end alone
+                    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                    size_t address = reinterpret_cast<size_t>(ptr);
+                    size_t begin = (address + page_size - 1) & ~(page_size - 1);
+                    size_t end = (address + size) & ~(page_size - 1);
+                    if (begin >= end)
+                    {
+                        return;
+                    }
+                    const int mpol_preferred = 1;
+                    const unsigned mpol_mf_move = 1 << 1;
+                    const size_t bits_per_mask = 8 * sizeof(unsigned long);
+                    int node = get_numa_node(id);
+                    std::vector<unsigned long> node_mask(node / bits_per_mask + 1, 0);
+                    node_mask[node / bits_per_mask] |= 1UL << (node % bits_per_mask);
+                    // Placement is a hint, failures leave the default first-touch policy
+                    syscall(SYS_mbind,
+                            reinterpret_cast<void*>(begin),
+                            end - begin,
+                            mpol_preferred,
+                            node_mask.data(),
+                            node_mask.size() * bits_per_mask + 1,
+                            mpol_mf_move);
+#endif
+                }
+
+                void CPUExecutor::parallel_for(int arena,
+                                               size_t n,
+                                               const Eigen::TensorOpCost& cost,
+                                               const std::function<void(size_t, size_t)>& f)
+                {
+                    if (n == 0)
+                    {
+                        return;
+                    }
+                    get_device(arena).parallelFor(
+                        static_cast<Eigen::Index>(n),
+                        cost,
+                        [&f](Eigen::Index first, Eigen::Index last) {
+                            f(static_cast<size_t>(first), static_cast<size_t>(last));
+                        });
+                }
+
+                void CPUExecutor::execute_async(std::function<void()> task)
+                {
+                    m_async_arena.enqueue(std::move(task));
+                }
+
+                static thread_local CPUExecutor* s_current_executor = nullptr;
+
+                CPUExecutorScope::CPUExecutorScope(CPUExecutor* executor)
+                    : m_previous(s_current_executor)
+                {
+                    if (executor != nullptr)
+                    {
+                        s_current_executor = executor;
+                    }
+                }
+
+                CPUExecutorScope::~CPUExecutorScope() { s_current_executor = m_previous; }
+
+                int GetThreadBudget()
+                {
+                    int hardware_threads =
+                        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+                    const auto ngraph_thread_budget = std::getenv("NGRAPH_CPU_THREAD_BUDGET");
+                    if (ngraph_thread_budget == nullptr)
+                    {
+                        return hardware_threads;
+                    }
+
+                    int count = std::atoi(ngraph_thread_budget);
+                    if (count < 1)
+                    {
+                        throw ngraph_error(
+                            "Unexpected value specified for NGRAPH_CPU_THREAD_BUDGET (" +
+                            std::string(ngraph_thread_budget) +
+                            "). Please specify a positive number of threads");
+                    }
+                    return count;
+                }
+
+                int GetAvailableThreads()
+                {
+                    auto& accounting = GetThreadAccounting();
+                    std::lock_guard<std::mutex> lock(accounting.mutex);
+                    return std::max(0, accounting.budget - accounting.in_use);
+                }
+
+                std::vector<int> ParseCPUList(const std::string& cpulist)
+                {
+                    std::vector<int> cpus;
+                    if (cpulist.empty())
+                    {
+                        return cpus;
+                    }
+                    // getline drops the empty entry after a trailing comma
+                    if (cpulist.back() == ',')
+                    {
+                        throw ngraph_error("Invalid CPU list '" + cpulist + "'");
+                    }
+                    auto parse_cpu = [&cpulist](const std::string& cpu) {
+                        if (cpu.empty() || cpu.size() > 9 ||
+                            cpu.find_first_not_of("0123456789") != std::string::npos)
+                        {
+                            throw ngraph_error("Invalid CPU list '" + cpulist + "'");
+                        }
+                        return std::atoi(cpu.c_str());
+                    };
+                    std::stringstream ss(cpulist);
+                    std::string range;
+                    while (std::getline(ss, range, ','))
+                    {
+                        auto dash = range.find('-');
+                        int first = parse_cpu(range.substr(0, dash));
+                        int last =
+                            dash == std::string::npos ? first : parse_cpu(range.substr(dash + 1));
+                        if (last < first)
+                        {
+                            throw ngraph_error("Invalid CPU list '" + cpulist + "'");
+                        }
+                        for (int cpu = first; cpu <= last; cpu++)
+                        {
+                            cpus.push_back(cpu);
+                        }
+                    }
+                    return cpus;
+                }
+
+                std::vector<std::pair<int, std::vector<int>>>
+                    GetNUMANodes(const std::string& node_dir)
+                {
+                    std::vector<std::pair<int, std::vector<int>>> nodes;
+                    for (int node = 0;; node++)
+                    {
+                        auto path = file_util::path_join(node_dir, "node" + std::to_string(node));
+                        if (!file_util::exists(path))
+                        {
+                            break;
+                        }
+                        std::ifstream f(file_util::path_join(path, "cpulist"));
+                        std::string cpulist;
+                        std::getline(f, cpulist);
+                        auto cpus = ParseCPUList(cpulist);
+                        if (!cpus.empty())
+                        {
+                            nodes.emplace_back(node, cpus);
+                        }
+                    }
+                    return nodes;
+                }
+
+                std::vector<std::pair<int, std::vector<int>>>
+                    AssignNUMANodes(int num_thread_pools,
+                                    const std::vector<std::pair<int, std::vector<int>>>& nodes)
+                {
+                    std::vector<std::pair<int, std::vector<int>>> pools(num_thread_pools);
+                    if (nodes.empty())
+                    {
+                        for (auto& pool : pools)
+                        {
+                            pool.first = -1;
+                        }
+                        return pools;
+                    }
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
+                        pools[i] = nodes[i % nodes.size()];
+                    }
+                    // With fewer pools than nodes, the remaining nodes are shared out so that
+                    // none of them sits idle
+                    for (size_t j = num_thread_pools; j < nodes.size(); j++)
+                    {
+                        auto& pool = pools[j % num_thread_pools];
+                        pool.first = -1;
+                        pool.second.insert(
+                            pool.second.end(), nodes[j].second.begin(), nodes[j].second.end());
+                    }
+                    return pools;
+                }
+
                 CPUExecutor& GetCPUExecutor()
                 {
+                    if (s_current_executor != nullptr)
+                    {
+                        return *s_current_executor;
+                    }
                     static int num_thread_pools = GetNumThreadPools();
                     static CPUExecutor cpu_executor(num_thread_pools < 1 ? 1 : num_thread_pools);
                     return cpu_executor;
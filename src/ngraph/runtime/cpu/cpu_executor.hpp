@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <thread>
 
 #include <mkldnn.hpp>
 
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 
 #define EIGEN_USE_THREADS
@@ -43,6 +46,12 @@ namespace ngraph
                 {
                 public:
                     explicit CPUExecutor(int num_thread_pools);
+                    // Executor with a fixed size, independent of the environment. When cpus is
+                    // not empty all threads of the thread pools are pinned to those CPUs.
+                    CPUExecutor(int num_thread_pools,
+                                int num_threads_per_pool,
+                                const std::vector<int>& cpus);
+                    ~CPUExecutor();
 
                     Eigen::ThreadPoolDevice& get_device(int id)
                     {
@@ -53,17 +62,108 @@ namespace ngraph
                                  CPURuntimeContext* ctx,
                                  CPUExecutionContext* ectx,
                                  bool use_tbb = false);
+                    // Run a task on the asynchronous execution arena without waiting for it
+                    void execute_async(std::function<void()> task);
+                    // Run f(begin, end) over blocks of [0, n) on thread pool `arena` and wait for
+                    // completion. cost is the cost of a single item and controls the block size.
+                    // Kernels use this instead of their own OpenMP regions so that all intra-op
+                    // parallelism shares the runtime owned thread pools.
+                    void parallel_for(int arena,
+                                      size_t n,
+                                      const Eigen::TensorOpCost& cost,
+                                      const std::function<void(size_t, size_t)>& f);
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
+                    // Upper bound on the threads all executors of the process run at once,
+                    // from NGRAPH_CPU_THREAD_BUDGET or the hardware concurrency. The thread
+                    // pools and dispatch threads of each executor are taken out of it.
+                    int get_thread_budget() const { return m_thread_budget; }
+                    // Threads running asynchronous calls and TBB flow graph nodes
+                    int get_num_dispatch_threads() const { return m_num_dispatch_threads; }
+                    int get_num_threads_per_pool() const { return m_num_threads_per_pool; }
+                    // True when NGRAPH_CPU_NUMA_AWARE is set and the host has NUMA nodes. Thread
+                    // pools are then spread over the NUMA nodes as by AssignNUMANodes.
+                    bool is_numa_aware() const { return m_numa_aware; }
+                    // NUMA node the threads of thread pool `id` are pinned to, -1 if they are
+                    // unpinned or span several nodes
+                    int get_numa_node(int id) const
+                    {
+                        return m_numa_aware ? m_numa_pools[id].first : -1;
+                    }
+                    // Prefer the NUMA node of thread pool `id` for the pages of
+                    // [ptr, ptr + size). No-op unless NUMA aware.
+                    void bind_memory(void* ptr, size_t size, int id);
+                    // Work-stealing scheduler with one worker per thread pool. Worker i runs
+                    // kernels on thread pool i. Null when there is a single thread pool.
+                    InterOpScheduler* get_inter_op_scheduler()
+                    {
+                        return m_inter_op_scheduler.get();
+                    }
+
                 private:
+                    // Takes the thread pools and dispatch threads out of the thread budget
+                    void reserve_threads(int num_threads_per_pool);
+                    void add_thread_pool(int num_threads, const std::vector<int>& cpus);
+
                     std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
                     std::vector<tbb::task_arena> m_tbb_arenas;
+                    // Arena servicing Executable::call_async requests
+                    tbb::task_arena m_async_arena;
+                    std::unique_ptr<InterOpScheduler> m_inter_op_scheduler;
                     int m_num_thread_pools;
                     int m_num_cores;
+                    int m_thread_budget;
+                    int m_num_threads_per_pool = 0;
+                    int m_num_dispatch_threads = 0;
+                    // Threads currently running kernels on each thread pool
+                    std::unique_ptr<std::atomic<int>[]> m_pool_callers;
+                    bool m_numa_aware;
+                    // NUMA node and CPUs of each thread pool when NUMA aware
+                    std::vector<std::pair<int, std::vector<int>>> m_numa_pools;
                 };
 
+                // Returns the executor of the executable running on this thread, or the process
+                // wide executor configured from the environment
                 extern CPUExecutor& GetCPUExecutor();
+
+                // Makes GetCPUExecutor() return `executor` on the current thread for the lifetime
+                // of the scope. A null executor leaves the current one in place.
+                class CPUExecutorScope
+                {
+                public:
+                    explicit CPUExecutorScope(CPUExecutor* executor);
+                    ~CPUExecutorScope();
+
+                private:
+                    CPUExecutorScope(const CPUExecutorScope&) = delete;
+                    CPUExecutorScope& operator=(const CPUExecutorScope&) = delete;
+
+                    CPUExecutor* m_previous;
+                };
+
+                // Returns NGRAPH_CPU_THREAD_BUDGET, or the hardware concurrency if it is not set
+                int GetThreadBudget();
+
+                // Threads of the process wide thread budget not taken by any executor
+                int GetAvailableThreads();
+
+                // Parse a CPU list such as "0-3,8,10-11". Throws ngraph_error on malformed
+                // lists, an empty string is an empty list.
+                std::vector<int> ParseCPUList(const std::string& cpulist);
+
+                // Returns {node id, CPUs} for every NUMA node under node_dir, normally
+                // /sys/devices/system/node, that has CPUs
+                std::vector<std::pair<int, std::vector<int>>>
+                    GetNUMANodes(const std::string& node_dir);
+
+                // Returns the {node id, CPUs} each thread pool is pinned to. With at least as
+                // many pools as nodes the pools go round-robin over the nodes. Otherwise the
+                // extra nodes are added to the pools round-robin, and a pool spanning several
+                // nodes has node id -1. Every pool gets node id -1 and no CPUs without nodes.
+                std::vector<std::pair<int, std::vector<int>>>
+                    AssignNUMANodes(int num_thread_pools,
+                                    const std::vector<std::pair<int, std::vector<int>>>& nodes);
             }
         }
     }
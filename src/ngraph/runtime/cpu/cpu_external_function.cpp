@@ -14,9 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -37,6 +39,7 @@
 #include "contrib/mlir/compiler/pass/mlir_subgraph_extraction.hpp"
 #endif
 
+#include "ngraph/compile_profiler.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/file_util.hpp"
@@ -147,6 +150,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
 #include "ngraph/pass/propagate_cacheability.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
@@ -498,7 +502,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
         femitter, node_function_map, common_function_string);
     pass_manager.run_passes(m_function);
 
-    list<shared_ptr<Node>> ordered_ops = m_function->get_ordered_ops();
+    vector<shared_ptr<Node>> ordered_ops = m_function->get_ordered_ops();
 
     CodeWriter writer;
 
@@ -1248,6 +1252,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass);
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory());
+    REGISTER_KNOBBED_PASS(MemorySchedule, true, ngraph::pass);
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
@@ -1270,6 +1275,16 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+size_t runtime::cpu::CPU_ExternalFunction::get_stale_index(const std::string& name)
+{
+    auto it = m_tensor_stale_indices.find(name);
+    if (it == m_tensor_stale_indices.end())
+    {
+        it = m_tensor_stale_indices.emplace(name, m_tensor_stale_indices.size()).first;
+    }
+    return it->second;
+}
+
 static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_tracer,
                                       runtime::cpu::TensorTracerAttributes& t_attrs,
                                       const std::string& kernel_name,
@@ -1360,6 +1375,21 @@ void runtime::cpu::CPU_ExternalFunction::dump_one_kernel(CPU_DebugTracer& debug_
     }
 }
 
+bool runtime::cpu::CPU_ExternalFunction::is_step_enabled(const ExecutionStep& step,
+                                                         CPURuntimeContext* ctx) const
+{
+    bool enabled = step.always_enabled;
+    for (size_t i = step.in_stale_begin; !enabled && i < step.out_stale_begin; i++)
+    {
+        enabled = ctx->tensor_stale[m_execution_plan_stale[i]];
+    }
+    for (size_t i = step.out_stale_begin; i < step.out_stale_end; i++)
+    {
+        ctx->tensor_stale[m_execution_plan_stale[i]] = enabled;
+    }
+    return enabled;
+}
+
 void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_config)
 {
     if (m_is_built)
@@ -1378,9 +1408,13 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     static const string s_debug_dir = "cpu_codegen";
     static StaticInitializers s_static_initializers(s_debug_dir);
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
+    // Build phases reported to the compile profiler
+    unique_ptr<CompileProfiler::Scope> build_phase(
+        new CompileProfiler::Scope("passes", "cpu_build"));
     ngraph::pass::Manager pass_manager;
     register_common_passes(pass_manager, pass_config);
     pass_manager.run_passes(m_function, false);
+    build_phase.reset(new CompileProfiler::Scope("buffer assignment", "cpu_build"));
 
     static runtime::cpu::CPU_DebugTracer debug_tracer;
     if (std::getenv("NGRAPH_CPU_DEBUG_TRACER") != nullptr)
@@ -1426,6 +1460,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
     // Build executor
     size_t buffer_index = 0;
+    // Tensor name to (address space, offset) for every non-constant tensor. Address space 0 is
+    // the temporary pool, function inputs and outputs each get their own space.
+    unordered_map<string, pair<size_t, size_t>> tensor_addresses;
     // Temporaries
     if (m_function->get_temporary_pool_size())
     {
@@ -1440,6 +1477,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     intermediates_offsets.emplace_back(m_buffer_indices[ele_t->get_name()],
                                                        ele_t->get_pool_offset());
                     m_tensor_roles[ele_t->get_name()] = TensorRole::INTERMEDIATE;
+                    tensor_addresses[ele_t->get_name()] =
+                        make_pair(size_t(0), ele_t->get_pool_offset());
                     buffer_index++;
                 }
             }
@@ -1480,12 +1519,14 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             auto output_tensor = &param->get_outputs().at(i).get_tensor();
             auto tensor_set = get_tensor_set(output_tensor);
 
-            auto& stale = tensor_stale[output_tensor->get_name()];
+            auto stale = get_stale_index(output_tensor->get_name());
             // process all tensors in the set containing the output tensor of the parameter
             for (auto& ele_t : tensor_set)
             {
                 m_tensor_roles[ele_t->get_name()] = TensorRole::INPUT;
                 m_buffer_indices[ele_t->get_name()] = buffer_index;
+                tensor_addresses[ele_t->get_name()] =
+                    make_pair(1 + 2 * arg_index, ele_t->get_pool_offset());
                 function_input_index_offset.emplace_back(m_buffer_indices[ele_t->get_name()],
                                                          arg_index,
                                                          ele_t->get_pool_offset(),
@@ -1508,6 +1549,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             m_tensor_roles[ele_t->get_name()] = TensorRole::OUTPUT;
             m_buffer_indices[ele_t->get_name()] = buffer_index;
+            tensor_addresses[ele_t->get_name()] = make_pair(2 + 2 * i, ele_t->get_pool_offset());
             function_output_index_offset.emplace_back(
                 m_buffer_indices[ele_t->get_name()], i, ele_t->get_pool_offset());
             buffer_index++;
@@ -1517,6 +1559,23 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    // Buffer accesses of already visited functors, per address space, used to order functors
+    // that share memory through in-place ops or memory reuse
+    struct BufferAccess
+    {
+        size_t begin;
+        size_t end;
+        size_t functor;
+        bool write;
+    };
+    unordered_map<size_t, vector<BufferAccess>> buffer_accesses;
+    unordered_map<Node*, size_t> functor_indices;
+    vector<set<size_t>> functor_predecessors;
+    m_execution_plan.clear();
+    m_execution_plan_stale.clear();
+    // Includes building the MKLDNN primitives of each op
+    build_phase.reset(new CompileProfiler::Scope("kernel build", "cpu_build"));
+
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1557,7 +1616,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names, t_out_attrs, t_in_attrs);
         op_names.push_back(node->get_name());
-        handler->second(this, node.get(), in, out);
+        {
+            CompileProfiler::Scope builder_scope(node->description(), "cpu_builder");
+            handler->second(this, node.get(), in, out);
+        }
 
         auto cacheable = true;
         auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
@@ -1574,59 +1636,111 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
              !cacheable) // Check cacheability only if we are reusing intermediate tensors
             || computes_result(node.get()) || possibly_overwritten(node.get()) || node->has_state();
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
+        // Staleness flags live in the runtime context so that every context tracks which of
+        // its own cached intermediates are still valid.
+        vector<size_t> in_stale, out_stale;
         for (const auto& name : in_names)
         {
             if (tensor_alias.count(name))
             {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                in_stale.push_back(get_stale_index(tensor_alias[name]));
             }
             else
             {
-                in_stale.emplace_back(tensor_stale[name]);
+                in_stale.push_back(get_stale_index(name));
             }
         }
         for (const auto& name : out_names)
         {
             if (tensor_alias.count(name))
             {
-                out_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                out_stale.push_back(get_stale_index(tensor_alias[name]));
             }
             else
             {
-                out_stale.emplace_back(tensor_stale[name]);
+                out_stale.push_back(get_stale_index(name));
             }
         }
 
-        function<bool(CPURuntimeContext*)> enable;
-        if (disable_caching)
+        // The step is the only description of when the op runs. The enable closure used by
+        // the TBB, scheduler and instrumented paths evaluates it like the replay loop does.
+        // The functor is set once all functors are built.
+        ExecutionStep step{nullptr, disable_caching, m_execution_plan_stale.size(), 0, 0};
+        if (!disable_caching)
         {
-            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                for (auto& stale : out_stale)
-                {
-                    stale.get() = true;
-                }
-                return true;
-            };
+            m_execution_plan_stale.insert(
+                m_execution_plan_stale.end(), in_stale.begin(), in_stale.end());
         }
-        else
+        step.out_stale_begin = m_execution_plan_stale.size();
+        m_execution_plan_stale.insert(
+            m_execution_plan_stale.end(), out_stale.begin(), out_stale.end());
+        step.out_stale_end = m_execution_plan_stale.size();
+        size_t step_index = m_execution_plan.size();
+        m_execution_plan.push_back(step);
+        function<bool(CPURuntimeContext*)> enable = [this, step_index](CPURuntimeContext* ctx) {
+            return is_step_enabled(m_execution_plan[step_index], ctx);
+        };
+
+        size_t functor_index = enables.size();
+        functor_indices[node.get()] = functor_index;
+        functor_predecessors.emplace_back();
+        auto& predecessors = functor_predecessors.back();
+        for (auto& arg : node->get_arguments())
         {
-            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                bool en = false;
-                for (const auto& stale : in_stale)
-                {
-                    if (stale)
-                    {
-                        en = true;
-                        break;
-                    }
-                }
-                for (auto& stale : out_stale)
+            auto it = functor_indices.find(arg.get());
+            if (it != functor_indices.end())
+            {
+                predecessors.insert(it->second);
+            }
+        }
+        for (auto& dep : node->get_control_dependencies())
+        {
+            auto it = functor_indices.find(dep.get());
+            if (it != functor_indices.end())
+            {
+                predecessors.insert(it->second);
+            }
+        }
+        auto add_buffer_access = [&](const TensorViewWrapper& tvw, bool write) {
+            auto address = tensor_addresses.find(tvw.get_name());
+            if (address == tensor_addresses.end())
+            {
+                return;
+            }
+            BufferAccess access{address->second.second,
+                                address->second.second + tvw.get_size() *
+                                                             tvw.get_element_type().size(),
+                                functor_index,
+                                write};
+            auto& accesses = buffer_accesses[address->second.first];
+            for (auto& prev : accesses)
+            {
+                if (prev.functor != functor_index && (write || prev.write) &&
+                    prev.begin < access.end && access.begin < prev.end)
                 {
-                    stale.get() = en;
+                    predecessors.insert(prev.functor);
                 }
-                return en;
-            };
+            }
+            if (write)
+            {
+                // Later accesses are ordered after this write, so covered accesses are redundant
+                accesses.erase(remove_if(accesses.begin(),
+                                         accesses.end(),
+                                         [&access](const BufferAccess& prev) {
+                                             return prev.begin >= access.begin &&
+                                                    prev.end <= access.end;
+                                         }),
+                               accesses.end());
+            }
+            accesses.push_back(access);
+        };
+        for (auto& tvw : in)
+        {
+            add_buffer_access(tvw, false);
+        }
+        for (auto& tvw : out)
+        {
+            add_buffer_access(tvw, true);
         }
 
         enables.emplace_back(enable);
@@ -1698,8 +1812,30 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
     // This check ensures we have exactly one functor for Op.
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
+    build_phase.reset(new CompileProfiler::Scope("execution plan", "cpu_build"));
+
+    m_functor_successors.assign(functors.size(), vector<size_t>());
+    m_functor_predecessor_counts.assign(functors.size(), 0);
+    for (size_t i = 0; i < functor_predecessors.size(); i++)
+    {
+        for (auto pred : functor_predecessors[i])
+        {
+            m_functor_successors[pred].push_back(i);
+        }
+        m_functor_predecessor_counts[i] = functor_predecessors[i].size();
+    }
+    NGRAPH_CHECK(m_execution_plan.size() == functors.size());
+    for (size_t i = 0; i < functors.size(); i++)
+    {
+        m_execution_plan[i].functor = &functors[i];
+    }
+    // The TBB flow graph already runs independent ops concurrently
+    m_use_inter_op_scheduler =
+        !m_use_tbb && executor::GetCPUExecutor().get_inter_op_scheduler() != nullptr;
+    build_phase.reset();
 
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
+        executor::CPUExecutorScope executor_scope(m_cpu_executor.get());
         cpu::Timestamp start_ts, end_ts;
         int profiler_count = 0;
 
@@ -1720,7 +1856,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         for (const auto& p : function_input_index_offset)
         {
             ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
-            get<3>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->tensor_stale[get<3>(p)] = ctx->p_en[get<1>(p)];
         }
 
         for (const auto& p : function_output_index_offset)
@@ -1746,6 +1882,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node =
                         new tbb::flow::continue_node<tbb::flow::continue_msg>(
                             *(ctx->G), [&, functor, index](const tbb::flow::continue_msg& msg) {
+                                // Nodes run on TBB worker threads
+                                executor::CPUExecutorScope worker_scope(m_cpu_executor.get());
                                 if (p(ctx) || ctx->first_iteration)
                                 {
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
@@ -1866,6 +2004,80 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
 
+            // Replay the captured execution plan when nothing needs per-op bookkeeping
+            if (!m_use_inter_op_scheduler && !ctx->first_iteration && ctx->pc == 0 &&
+                ctx->breakpoints.empty() && !m_emit_timing && !runtime::cpu::IsTracingEnabled() &&
+                !debug_tracer.tracing_is_enabled() && ddebug == nullptr)
+            {
+                auto& cpu_executor = executor::GetCPUExecutor();
+                CPUExecutionContext ectx{ctx->arena};
+                for (const auto& step : m_execution_plan)
+                {
+                    if (is_step_enabled(step, ctx))
+                    {
+                        cpu_executor.execute(*step.functor, ctx, &ectx);
+                    }
+                }
+                ctx->pc = functors.size();
+            }
+
+            // The first iteration builds per-context state such as mkldnn primitives and runs
+            // sequentially. Breakpoints and the debug tracer need a deterministic order.
+            if (m_use_inter_op_scheduler && !ctx->first_iteration && ctx->pc == 0 &&
+                ctx->breakpoints.empty() && !debug_tracer.tracing_is_enabled())
+            {
+                auto task = [&](size_t index, size_t worker) {
+                    executor::CPUExecutorScope worker_scope(m_cpu_executor.get());
+                    if (enables[index](ctx))
+                    {
+                        cpu::Timestamp task_start_ts;
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            task_start_ts = cpu::Clock::now();
+                        }
+
+                        CPUExecutionContext ectx{static_cast<int>(worker)};
+                        executor::GetCPUExecutor().execute(functors[index], ctx, &ectx);
+
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            auto task_end_ts = cpu::Clock::now();
+
+                            if (runtime::cpu::IsTracingEnabled())
+                            {
+                                ctx->op_durations[index] =
+                                    (std::chrono::duration_cast<cpu::Timescale>(task_end_ts -
+                                                                                task_start_ts))
+                                        .count();
+                            }
+                            if (m_emit_timing)
+                            {
+                                m_perf_counters[index].m_total_microseconds +=
+                                    std::chrono::duration_cast<std::chrono::microseconds>(
+                                        task_end_ts - task_start_ts)
+                                        .count();
+                                m_perf_counters[index].m_call_count++;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        if (runtime::cpu::IsTracingEnabled())
+                        {
+                            ctx->op_durations[index] = 0;
+                        }
+                        if (m_emit_timing)
+                        {
+                            m_perf_counters[index].m_call_count++;
+                        }
+                    }
+                };
+                executor::GetCPUExecutor().get_inter_op_scheduler()->run(
+                    m_functor_successors, m_functor_predecessor_counts, task);
+                profiler_count = static_cast<int>(functors.size());
+                ctx->pc = functors.size();
+            }
+
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
@@ -1879,7 +2091,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         start_ts = cpu::Clock::now();
                     }
 
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{ctx->arena};
 
                     if (debug_tracer.tracing_is_enabled())
                     {
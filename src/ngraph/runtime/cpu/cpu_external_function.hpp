@@ -63,6 +63,10 @@ namespace ngraph
             class CPU_CallFrame;
             class CPU_Debugger;
             class CPU_DebugTracer;
+            namespace executor
+            {
+                class CPUExecutor;
+            }
 
 #if !defined(NGRAPH_DEX_ONLY)
 
@@ -156,6 +160,16 @@ namespace ngraph
                     return m_states.size() - 1;
                 }
 
+                // Run this function on a dedicated executor instead of the process wide one. Must
+                // be called before the function is built.
+                void set_cpu_executor(const std::shared_ptr<executor::CPUExecutor>& cpu_executor)
+                {
+                    m_cpu_executor = cpu_executor;
+                }
+                const std::shared_ptr<executor::CPUExecutor>& get_cpu_executor() const
+                {
+                    return m_cpu_executor;
+                }
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
@@ -166,6 +180,8 @@ namespace ngraph
                 // tensor
                 size_t get_buffer_index(const std::string& name);
                 size_t get_buffer_size() const { return m_buffer_size; }
+                // return the number of per-context staleness flags used by DEX caching
+                size_t get_stale_flag_count() const { return m_tensor_stale_indices.size(); }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -223,6 +239,7 @@ namespace ngraph
                                             ngraph::pass::PassConfig& pass_config);
 
                 bool computes_result(Node* node);
+                size_t get_stale_index(const std::string& name);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
@@ -299,12 +316,39 @@ namespace ngraph
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
                     enable_nodename_list;
+                // Dependency DAG over functors used by the inter-op scheduler. Edges come from
+                // data and control dependencies and from overlapping buffer accesses.
+                std::vector<std::vector<size_t>> m_functor_successors;
+                std::vector<size_t> m_functor_predecessor_counts;
+                bool m_use_inter_op_scheduler = false;
+                // Flat functor schedule replayed by DEX calls after the first iteration when no
+                // profiling, tracing or debugging is active. Each step holds the condition under
+                // which its op runs as plain data, the closures in enables evaluate it too.
+                struct ExecutionStep
+                {
+                    CPUKernelFunctor* functor;
+                    // Uncached ops always run, cached ones only when one of their inputs is stale
+                    bool always_enabled;
+                    // Input flags are [in_stale_begin, out_stale_begin) of m_execution_plan_stale
+                    size_t in_stale_begin;
+                    size_t out_stale_begin;
+                    size_t out_stale_end;
+                };
+                std::vector<ExecutionStep> m_execution_plan;
+                // Indices into the cpu_runtime_context's tensor_stale array for all steps
+                std::vector<size_t> m_execution_plan_stale;
+                // Whether the op of a step runs on this call. Marks the outputs of the step stale
+                // when it runs and fresh when it is skipped.
+                bool is_step_enabled(const ExecutionStep& step, CPURuntimeContext* ctx) const;
+                // Dedicated executor, null for the process wide executor
+                std::shared_ptr<executor::CPUExecutor> m_cpu_executor;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to
                 // get the tensor
                 std::unordered_map<std::string, size_t> m_buffer_indices;
-                std::unordered_map<std::string, bool> tensor_stale;
+                // name of a tensor and index into the cpu_runtime_context's tensor_stale array
+                std::unordered_map<std::string, size_t> m_tensor_stale_indices;
                 // Each tensor is put into one buffer set.
                 // All the tensors in the same buffer set share the same memory buffer.
                 // bufferID_to_tensorSets maps bufferID to the pair of TensorRole and buffer set.
@@ -327,10 +371,9 @@ namespace ngraph
                 // used to get the address at runtime
                 std::list<std::pair<size_t, void*>> constant_tensor_data;
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
-                // input index, offset into the input, and if the input is stale
+                // input index, offset into the input, and index of the input's staleness flag
                 // used to calculate the correct address at runtime
-                std::list<std::tuple<size_t, size_t, size_t, std::reference_wrapper<bool>>>
-                    function_input_index_offset;
+                std::list<std::tuple<size_t, size_t, size_t, size_t>> function_input_index_offset;
                 // index to the cpu_runtime_context's buffer_data vector to get a tensor,
                 // output index, and offset into the output.
                 // used to calculate the correct address at runtime
@@ -0,0 +1,204 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::InterOpScheduler::InterOpScheduler(size_t num_threads)
+{
+    num_threads = num_threads < 1 ? 1 : num_threads;
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        m_queues.emplace_back(new WorkQueue);
+    }
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        m_threads.emplace_back([this, i]() { worker_loop(i); });
+    }
+}
+
+runtime::cpu::InterOpScheduler::~InterOpScheduler()
+{
+    {
+        lock_guard<mutex> lock(m_sleep_mutex);
+        m_stop = true;
+    }
+    m_sleep_cv.notify_all();
+    for (auto& t : m_threads)
+    {
+        t.join();
+    }
+}
+
+void runtime::cpu::InterOpScheduler::push(size_t queue, WorkItem item)
+{
+    {
+        lock_guard<mutex> lock(m_queues[queue]->mutex);
+        m_queues[queue]->items.push_back(item);
+    }
+    m_num_ready++;
+    if (m_num_sleepers.load() > 0)
+    {
+        lock_guard<mutex> lock(m_sleep_mutex);
+        m_sleep_cv.notify_one();
+    }
+}
+
+bool runtime::cpu::InterOpScheduler::pop(size_t queue, WorkItem& item)
+{
+    if (m_num_ready.load() == 0)
+    {
+        return false;
+    }
+
+    // Own queue first, LIFO for locality
+    {
+        WorkQueue& own = *m_queues[queue];
+        lock_guard<mutex> lock(own.mutex);
+        if (!own.items.empty())
+        {
+            item = own.items.back();
+            own.items.pop_back();
+            m_num_ready--;
+            return true;
+        }
+    }
+
+    // Steal the oldest item from another queue
+    for (size_t i = 1; i < m_queues.size(); i++)
+    {
+        WorkQueue& victim = *m_queues[(queue + i) % m_queues.size()];
+        lock_guard<mutex> lock(victim.mutex);
+        if (!victim.items.empty())
+        {
+            item = victim.items.front();
+            victim.items.pop_front();
+            m_num_ready--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::cpu::InterOpScheduler::execute(size_t worker, WorkItem item)
+{
+    Job& job = *item.job;
+    if (!job.failed)
+    {
+        try
+        {
+            (*job.task)(item.index, worker);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(job.error_mutex);
+            if (!job.failed)
+            {
+                job.error = current_exception();
+                job.failed = true;
+            }
+        }
+    }
+
+    for (size_t successor : (*job.successors)[item.index])
+    {
+        if (--job.pending[successor] == 0)
+        {
+            push(worker, WorkItem{&job, successor});
+        }
+    }
+
+    if (--job.remaining == 0)
+    {
+        // The owner of the job may be sleeping
+        lock_guard<mutex> lock(m_sleep_mutex);
+        m_sleep_cv.notify_all();
+    }
+}
+
+void runtime::cpu::InterOpScheduler::worker_loop(size_t worker)
+{
+    while (true)
+    {
+        WorkItem item;
+        if (pop(worker, item))
+        {
+            execute(worker, item);
+            continue;
+        }
+
+        unique_lock<mutex> lock(m_sleep_mutex);
+        m_num_sleepers++;
+        m_sleep_cv.wait(lock, [this]() { return m_stop || m_num_ready.load() > 0; });
+        m_num_sleepers--;
+        if (m_stop)
+        {
+            return;
+        }
+    }
+}
+
+void runtime::cpu::InterOpScheduler::run(const vector<vector<size_t>>& successors,
+                                         const vector<size_t>& predecessor_counts,
+                                         const Task& task)
+{
+    size_t count = successors.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    Job job;
+    job.successors = &successors;
+    job.task = &task;
+    job.pending.reset(new atomic<size_t>[count]);
+    job.remaining = count;
+    job.failed = false;
+    for (size_t i = 0; i < count; i++)
+    {
+        job.pending[i] = predecessor_counts[i];
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        if (predecessor_counts[i] == 0)
+        {
+            push(0, WorkItem{&job, i});
+        }
+    }
+
+    while (job.remaining.load() != 0)
+    {
+        WorkItem item;
+        if (pop(0, item))
+        {
+            execute(0, item);
+            continue;
+        }
+
+        unique_lock<mutex> lock(m_sleep_mutex);
+        m_num_sleepers++;
+        m_sleep_cv.wait(lock,
+                        [&job, this]() { return job.remaining == 0 || m_num_ready.load() > 0; });
+        m_num_sleepers--;
+    }
+
+    if (job.error)
+    {
+        rethrow_exception(job.error);
+    }
+}
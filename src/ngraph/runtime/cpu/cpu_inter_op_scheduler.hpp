@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Runs the functors of a DEX graph according to a static dependency DAG on a pool of
+            // work-stealing threads. Each thread owns a deque; it pushes newly ready functors to
+            // the back and pops from the back, idle threads steal from the front of other
+            // deques. The thread calling run() participates as worker 0 and any number of
+            // threads may call run() concurrently.
+            class InterOpScheduler
+            {
+            public:
+                // Task invoked with the functor index and the index of the executing worker
+                using Task = std::function<void(size_t, size_t)>;
+
+                // num_threads includes the calling thread
+                explicit InterOpScheduler(size_t num_threads);
+                ~InterOpScheduler();
+
+                size_t get_num_threads() const { return m_queues.size(); }
+                // Execute every node of the DAG and wait for completion. successors[i] lists the
+                // nodes that depend on node i and predecessor_counts[i] is the number of nodes
+                // node i depends on. The first exception thrown by a task is rethrown here once
+                // all started tasks have finished; tasks not yet started are skipped.
+                void run(const std::vector<std::vector<size_t>>& successors,
+                         const std::vector<size_t>& predecessor_counts,
+                         const Task& task);
+
+            private:
+                struct Job
+                {
+                    const std::vector<std::vector<size_t>>* successors;
+                    const Task* task;
+                    std::unique_ptr<std::atomic<size_t>[]> pending;
+                    std::atomic<size_t> remaining;
+                    std::atomic<bool> failed;
+                    std::mutex error_mutex;
+                    std::exception_ptr error;
+                };
+
+                struct WorkItem
+                {
+                    Job* job;
+                    size_t index;
+                };
+
+                struct WorkQueue
+                {
+                    std::mutex mutex;
+                    std::deque<WorkItem> items;
+                };
+
+                void push(size_t queue, WorkItem item);
+                bool pop(size_t queue, WorkItem& item);
+                void execute(size_t worker, WorkItem item);
+                void worker_loop(size_t worker);
+
+                std::vector<std::unique_ptr<WorkQueue>> m_queues;
+                std::vector<std::thread> m_threads;
+
+                std::atomic<size_t> m_num_ready{0};
+                std::atomic<size_t> m_num_sleepers{0};
+                std::mutex m_sleep_mutex;
+                std::condition_variable m_sleep_cv;
+                bool m_stop = false;
+            };
+        }
+    }
+}
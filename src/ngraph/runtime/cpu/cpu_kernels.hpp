@@ -271,7 +271,8 @@ namespace ngraph
                                       bool training,
                                       const double value,
                                       const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed);
+                                      const bool use_seed,
+                                      int arena);
             }
         }
     }
@@ -60,6 +60,8 @@ namespace ngraph
             {
                 int64_t* op_durations;
                 bool* p_en;
+                // per-tensor staleness flags used to skip recomputation of cached results
+                bool* tensor_stale;
                 bool first_iteration;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
@@ -71,6 +73,8 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // thread pool running the kernels of this context
+                int arena;
 #ifdef NGRAPH_MLIR_ENABLE
                 /// Maps CompiledKernel nodes to their MLIR compiler
                 /// The MLIR compiler caches the compiled code on the first invocation,
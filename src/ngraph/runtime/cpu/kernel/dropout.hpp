@@ -18,6 +18,7 @@
 
 #include <random>
 
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/state/rng_state.hpp"
 
@@ -38,58 +39,62 @@ namespace ngraph
                                       const bool training,
                                       const double keep_prob,
                                       const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed)
+                                      const bool use_seed,
+                                      int arena)
                 {
                     if (training)
-
                     {
                         int32_t rnd_seed = rand();
                         double dropout_prob = 1 - keep_prob;
-#ifdef _OPENMP
                         size_t nthr =
                             ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
                         size_t chunk_size = (nelems + nthr - 1) / nthr;
 
-#pragma omp parallel num_threads(nthr)
-                        {
-                            size_t tid = omp_get_thread_num();
-#else
-                        size_t chunk_size = nelems;
-                        {
-                            size_t tid = 0;
-#endif
-                            // Note :
-                            // In this implementation of dropout, we are trying to be same as PDPD
-                            // native implementation (and other frameworks).
-                            // https://github.com/NervanaSystems/ngraph-paddle/blob/14d88829b386c9f7601788c5539c08326dcbe2fe/paddle/fluid/operators/dropout_op.h#L58-L78
-                            // So, if framework passes same seed, then we will get same mask.
-                            std::minstd_rand msr;
-                            if (use_seed)
-                            {
-                                msr = vmsr[tid];
-                            }
-                            else
-                            {
-                                msr.seed(rnd_seed + tid);
-                            }
-                            std::uniform_real_distribution<> gen(0, 1);
-
-                            size_t idx_start = tid * chunk_size;
-                            size_t idx_end = std::min(idx_start + chunk_size, nelems);
-                            for (size_t idx = idx_start; idx < idx_end; ++idx)
+                        // Each chunk has its own generator, the mask does not depend on how the
+                        // chunks are distributed over threads
+                        auto generate_chunks = [&](size_t first, size_t last) {
+                            for (size_t tid = first; tid < last; tid++)
                             {
-                                if (static_cast<T>(gen(msr)) < dropout_prob)
+                                // Note :
+                                // In this implementation of dropout, we are trying to be same as
+                                // PDPD native implementation (and other frameworks).
+                                // https://github.com/NervanaSystems/ngraph-paddle/blob/14d88829b386c9f7601788c5539c08326dcbe2fe/paddle/fluid/operators/dropout_op.h#L58-L78
+                                // So, if framework passes same seed, then we will get same mask.
+                                std::minstd_rand msr;
+                                if (use_seed)
                                 {
-                                    out1_mask[idx] = 0;
-                                    out0[idx] = 0;
+                                    msr = vmsr[tid];
                                 }
                                 else
                                 {
-                                    out1_mask[idx] = 1;
-                                    out0[idx] = input[idx] / static_cast<T>(keep_prob);
+                                    msr.seed(rnd_seed + tid);
+                                }
+                                std::uniform_real_distribution<> gen(0, 1);
+
+                                size_t idx_start = tid * chunk_size;
+                                size_t idx_end = std::min(idx_start + chunk_size, nelems);
+                                for (size_t idx = idx_start; idx < idx_end; ++idx)
+                                {
+                                    if (static_cast<T>(gen(msr)) < dropout_prob)
+                                    {
+                                        out1_mask[idx] = 0;
+                                        out0[idx] = 0;
+                                    }
+                                    else
+                                    {
+                                        out1_mask[idx] = 1;
+                                        out0[idx] = input[idx] / static_cast<T>(keep_prob);
+                                    }
                                 }
                             }
-                        }
+                        };
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().parallel_for(
+                            arena,
+                            nthr,
+                            Eigen::TensorOpCost(chunk_size * sizeof(T),
+                                                2 * chunk_size * sizeof(T),
+                                                chunk_size * 10.0),
+                            generate_chunks);
                     }
                     else
                     {
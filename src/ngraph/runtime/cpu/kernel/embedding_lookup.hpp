@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/cpu/kernel/gather.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Copies the weights row selected by each index to out, which has shape
+                // {indices_count, vector length}.
+                template <typename T, typename U>
+                void embedding(const U* indices,
+                               const T* weights,
+                               T* out,
+                               size_t indices_count,
+                               const Shape& out_shape,
+                               int arena)
+                {
+                    size_t vec_len = out_shape.at(1);
+                    gather_rows(weights,
+                                out,
+                                indices_count,
+                                vec_len,
+                                [&](size_t r) { return static_cast<size_t>(indices[r]) * vec_len; },
+                                arena);
+                }
+            }
+        }
+    }
+}
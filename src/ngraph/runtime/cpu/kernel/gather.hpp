@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstring>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -151,107 +153,165 @@ namespace ngraph
                             num_indices *= d;
                         }
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-                        for (int i = 0; i < outer_loop_num * num_indices; i++)
-                        {
-                            Eigen::array<Eigen::Index, Rank1> in_extents, in_offsets;
-                            Eigen::array<Eigen::Index, Rank2> out_extents, out_offsets;
-                            std::vector<int> indices_before_axis(axis);
-                            // indices_before_axis depends on inputs_shape[0,..., axis-1] and i /
-                            // num_indices.
-                            // if axis is 0, indices_before_axis is empty.
-                            get_indices(inputs_shape, i / num_indices, indices_before_axis, axis);
-                            std::vector<int> indices_from_indices_arg(indices_rank);
-
-                            // before axis
-                            for (int r = 0; r < axis; r++)
+                        // Slices are copied in parallel on the runtime thread pool. A single
+                        // slice is copied with the thread pool device instead.
+                        size_t num_slices = outer_loop_num * num_indices;
+                        auto& executor = ngraph::runtime::cpu::executor::GetCPUExecutor();
+                        auto gather_slices = [&](size_t first, size_t last) {
+                            for (size_t i = first; i < last; i++)
                             {
-                                in_extents[r] = 1;
-                                in_offsets[r] = indices_before_axis[r];
-                            }
-                            // from axis
-                            for (int r = axis; r < Rank1; r++)
-                            {
-                                in_extents[r] = inputs_shape[r];
-                                in_offsets[r] = 0;
+                                Eigen::array<Eigen::Index, Rank1> in_extents, in_offsets;
+                                Eigen::array<Eigen::Index, Rank2> out_extents, out_offsets;
+                                std::vector<int> indices_before_axis(axis);
+                                // indices_before_axis depends on inputs_shape[0,..., axis-1] and
+                                // i / num_indices.
+                                // if axis is 0, indices_before_axis is empty.
+                                get_indices(
+                                    inputs_shape, i / num_indices, indices_before_axis, axis);
+                                std::vector<int> indices_from_indices_arg(indices_rank);
+
+                                // before axis
+                                for (int r = 0; r < axis; r++)
+                                {
+                                    in_extents[r] = 1;
+                                    in_offsets[r] = indices_before_axis[r];
+                                }
+                                // from axis
+                                for (int r = axis; r < Rank1; r++)
+                                {
+                                    in_extents[r] = inputs_shape[r];
+                                    in_offsets[r] = 0;
+                                }
+                                // at axis
+                                in_extents[axis] = 1;
+                                // before axis
+                                for (int r = 0; r < axis; r++)
+                                {
+                                    out_extents[r] = 1;
+                                    out_offsets[r] = indices_before_axis[r];
+                                }
+                                // from axis
+                                for (int r = axis; r < Rank2; r++)
+                                {
+                                    out_extents[r] = output_shape[r];
+                                    out_offsets[r] = 0;
+                                }
+                                // at axis, get the value from indices arg
+                                int k = i % num_indices;
+                                in_offsets[axis] = indices_ptr[k];
+
+                                // indices_from_indices_arg depends on indices_shape and k.
+                                // suppose the inputs has shape {3, 3, 3}, indices has shape
+                                // {2, 2}, and axis is 1, the output would have shape
+                                // {3, 2, 2, 3} and indices_from_indices_arg would contain indices
+                                // at position 1 and 2 for output slice offsets.
+                                get_indices(
+                                    indices_shape, k, indices_from_indices_arg, indices_rank);
+                                for (int j = 0; j < indices_rank; j++)
+                                {
+                                    out_extents[j + axis] = 1;
+                                    out_offsets[j + axis] = indices_from_indices_arg[j];
+                                }
+
+                                if (num_slices == 1)
+                                {
+                                    out.slice(out_offsets, out_extents)
+                                        .device(executor.get_device(arena)) =
+                                        in.slice(in_offsets, in_extents).reshape(out_extents);
+                                }
+                                else
+                                {
+                                    out.slice(out_offsets, out_extents) =
+                                        in.slice(in_offsets, in_extents).reshape(out_extents);
+                                }
                             }
-                            // at axis
-                            in_extents[axis] = 1;
-                            // before axis
-                            for (int r = 0; r < axis; r++)
+                        };
+                        if (num_slices <= 1)
+                        {
+                            gather_slices(0, num_slices);
+                        }
+                        else
+                        {
+                            size_t slice_bytes =
+                                shape_size(output_shape) / num_slices * sizeof(ElementType);
+                            executor.parallel_for(
+                                arena,
+                                num_slices,
+                                Eigen::TensorOpCost(slice_bytes, slice_bytes, slice_bytes),
+                                gather_slices);
+                        }
+                    }
+                }
+
+                // Copies num_rows rows of row_len contiguous elements to out. Row r is read from
+                // params + offset(r). Rows are split over the thread pool. Gathered rows are
+                // scattered over params, so the start of the row a few iterations ahead is
+                // prefetched while the current one is copied.
+                template <typename ElementType, typename OffsetFunction>
+                void gather_rows(const ElementType* params,
+                                 ElementType* out,
+                                 size_t num_rows,
+                                 size_t row_len,
+                                 const OffsetFunction& offset,
+                                 int arena)
+                {
+                    const size_t prefetch_distance = 4;
+                    auto copy_rows = [&](size_t first, size_t last) {
+                        ElementType* dst = out + first * row_len;
+                        for (size_t r = first; r < last; r++, dst += row_len)
+                        {
+#if defined(__GNUC__)
+                            if (r + prefetch_distance < last)
                             {
-                                out_extents[r] = 1;
-                                out_offsets[r] = indices_before_axis[r];
+                                __builtin_prefetch(params + offset(r + prefetch_distance));
                             }
-                            // from axis
-                            for (int r = axis; r < Rank2; r++)
+#endif
+                            const ElementType* src = params + offset(r);
+                            if (row_len == 1)
                             {
-                                out_extents[r] = output_shape[r];
-                                out_offsets[r] = 0;
+                                *dst = *src;
                             }
-                            // at axis, get the value from indices arg
-                            int k = i % num_indices;
-                            in_offsets[axis] = indices_ptr[k];
-
-                            // indices_from_indices_arg depends on indices_shape and k.
-                            // suppose the inputs has shape {3, 3, 3}, indices has shape {2, 2}, and
-                            // axis is 1, the output would have shape {3, 2, 2, 3} and
-                            // indices_from_indices_arg would contain indices at position 1 and 2
-                            // for output slice offsets.
-                            get_indices(indices_shape, k, indices_from_indices_arg, indices_rank);
-                            for (int j = 0; j < indices_rank; j++)
+                            else
                             {
-                                out_extents[j + axis] = 1;
-                                out_offsets[j + axis] = indices_from_indices_arg[j];
+                                memcpy(dst, src, row_len * sizeof(ElementType));
                             }
-
-                            out.slice(out_offsets, out_extents)
-                                .device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                    arena)) = in.slice(in_offsets, in_extents).reshape(out_extents);
                         }
-                    }
-                }
-
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void gather_i64(void* inputs,
-                                void* indices,
-                                void* output,
-                                const Shape& inputs_shape,
-                                const Shape& indices_shape,
-                                const Shape& output_shape,
-                                size_t axis,
-                                int arena)
-                {
-                    gather<ElementType, int64_t, Rank1, Rank2>(inputs,
-                                                               indices,
-                                                               output,
-                                                               inputs_shape,
-                                                               indices_shape,
-                                                               output_shape,
-                                                               axis,
-                                                               arena);
+                    };
+                    size_t row_bytes = row_len * sizeof(ElementType);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().parallel_for(
+                        arena,
+                        num_rows,
+                        Eigen::TensorOpCost(row_bytes, row_bytes, row_len),
+                        copy_rows);
                 }
 
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void gather_i32(void* inputs,
-                                void* indices,
-                                void* output,
-                                const Shape& inputs_shape,
-                                const Shape& indices_shape,
-                                const Shape& output_shape,
-                                size_t axis,
-                                int arena)
+                // Gather along axis as rows: params is viewed as [outer, axis, inner] and out as
+                // [outer, indices, inner], so every index selects one row of inner elements.
+                template <typename ElementType, typename IndicesType>
+                void gather_along_axis(const ElementType* params,
+                                       const IndicesType* indices,
+                                       ElementType* out,
+                                       const Shape& params_shape,
+                                       const Shape& indices_shape,
+                                       size_t axis,
+                                       int arena)
                 {
-                    gather<ElementType, int32_t, Rank1, Rank2>(inputs,
-                                                               indices,
-                                                               output,
-                                                               inputs_shape,
-                                                               indices_shape,
-                                                               output_shape,
-                                                               axis,
-                                                               arena);
+                    size_t outer =
+                        shape_size(Shape(params_shape.begin(), params_shape.begin() + axis));
+                    size_t inner =
+                        shape_size(Shape(params_shape.begin() + axis + 1, params_shape.end()));
+                    size_t axis_len = params_shape[axis];
+                    size_t num_indices = shape_size(indices_shape);
+                    gather_rows(params,
+                                out,
+                                outer * num_indices,
+                                inner,
+                                [&](size_t r) {
+                                    return ((r / num_indices) * axis_len +
+                                            static_cast<size_t>(indices[r % num_indices])) *
+                                           inner;
+                                },
+                                arena);
                 }
             }
         }
@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/cpu/kernel/gather.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Each vector along the last axis of indices addresses a slice of params by its
+                // leading coordinates. The slices are contiguous, so they are copied as rows.
+                template <typename T, typename U>
+                void gather_nd(const T* params,
+                               const U* indices,
+                               T* out,
+                               const Shape& params_shape,
+                               const Shape& indices_shape,
+                               int arena)
+                {
+                    size_t slice_rank = indices_shape.back();
+                    size_t num_slices =
+                        shape_size(Shape(indices_shape.begin(), indices_shape.end() - 1));
+                    size_t slice_size =
+                        shape_size(Shape(params_shape.begin() + slice_rank, params_shape.end()));
+                    std::vector<size_t> params_strides = row_major_strides(params_shape);
+                    gather_rows(params,
+                                out,
+                                num_slices,
+                                slice_size,
+                                [&](size_t r) {
+                                    const U* index = indices + r * slice_rank;
+                                    size_t offset = 0;
+                                    for (size_t i = 0; i < slice_rank; i++)
+                                    {
+                                        offset += static_cast<size_t>(index[i]) * params_strides[i];
+                                    }
+                                    return offset;
+                                },
+                                arena);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,366 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace quantize_detail
+                {
+                    // Splits the input into rows that map to consecutive scales and zero points.
+                    // One scale applies to a whole row, unless the trailing axes are all
+                    // quantization axes; then the scale advances with every element of the row.
+                    class ScaleLayout
+                    {
+                    public:
+                        ScaleLayout(const Shape& input_shape,
+                                    const Shape& scale_shape,
+                                    const AxisSet& axes)
+                            : m_per_element(false)
+                        {
+                            size_t rank = input_shape.size();
+                            std::vector<size_t> scale_strides = row_major_strides(scale_shape);
+                            std::vector<size_t> axis_strides(rank, 0);
+                            size_t i = 0;
+                            for (size_t axis : axes)
+                            {
+                                axis_strides[axis] = scale_strides[i++];
+                            }
+
+                            size_t split = rank;
+                            while (split > 0 && axes.count(split - 1) == 0)
+                            {
+                                split--;
+                            }
+                            if (rank > 0 && split == rank)
+                            {
+                                m_per_element = true;
+                                while (split > 0 && axes.count(split - 1) != 0)
+                                {
+                                    split--;
+                                }
+                            }
+                            m_row_len =
+                                shape_size(Shape(input_shape.begin() + split, input_shape.end()));
+                            m_outer_shape = Shape(input_shape.begin(), input_shape.begin() + split);
+                            m_outer_strides.assign(axis_strides.begin(),
+                                                   axis_strides.begin() + split);
+                        }
+
+                        // Index of the first scale used by row
+                        size_t offset(size_t row) const
+                        {
+                            size_t offset = 0;
+                            for (size_t d = m_outer_shape.size(); d-- > 0;)
+                            {
+                                offset += (row % m_outer_shape[d]) * m_outer_strides[d];
+                                row /= m_outer_shape[d];
+                            }
+                            return offset;
+                        }
+
+                        size_t get_row_len() const { return m_row_len; }
+                        bool is_per_element() const { return m_per_element; }
+
+                    private:
+                        size_t m_row_len;
+                        bool m_per_element;
+                        Shape m_outer_shape;
+                        std::vector<size_t> m_outer_strides;
+                    };
+
+                    // Calls run(first, count, scale_index) over blocks of [0, n) in parallel.
+                    // Blocks end at row boundaries so that the scales of a block are either a
+                    // single value or contiguous.
+                    template <typename RunFunction>
+                    void for_each_block(const ScaleLayout& layout,
+                                        size_t n,
+                                        const Eigen::TensorOpCost& cost,
+                                        const RunFunction& run,
+                                        int arena)
+                    {
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().parallel_for(
+                            arena, n, cost, [&](size_t first, size_t last) {
+                                size_t i = first;
+                                while (i < last)
+                                {
+                                    size_t row = i / layout.get_row_len();
+                                    size_t end = std::min(last, (row + 1) * layout.get_row_len());
+                                    size_t scale_index = layout.offset(row);
+                                    if (layout.is_per_element())
+                                    {
+                                        scale_index += i - row * layout.get_row_len();
+                                    }
+                                    run(i, end - i, scale_index);
+                                    i = end;
+                                }
+                            });
+                    }
+
+                    // Every round mode is computed from floor(y) for y = x, |x|, -x or -|x|.
+                    // std::floor only vectorizes without -ftrapping-math, so the floor itself
+                    // is left to Eigen's packet floor, and the two plain loops around it are
+                    // free of calls and branches.
+                    template <op::Quantize::RoundMode MODE, typename T>
+                    inline T floor_argument(T x)
+                    {
+                        typedef op::Quantize::RoundMode RoundMode;
+                        switch (MODE)
+                        {
+                        case RoundMode::ROUND_NEAREST_UPWARD:
+                        case RoundMode::ROUND_NEAREST_DOWNWARD:
+                        case RoundMode::ROUND_NEAREST_TOWARD_EVEN:
+                        case RoundMode::ROUND_DOWN: return x;
+                        case RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+                        case RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+                        case RoundMode::ROUND_TOWARD_ZERO: return std::fabs(x);
+                        case RoundMode::ROUND_TOWARD_INFINITY: return -std::fabs(x);
+                        case RoundMode::ROUND_UP: return -x;
+                        }
+                        return x;
+                    }
+
+                    // Rounds y to the nearest integer given down = floor(y) and, for ties to
+                    // even, half = floor(down / 2). Ties are resolved by comparing against
+                    // down + 0.5, which is exact for every non-integer y, rather than by rounding
+                    // y + 0.5. Bitwise operators avoid branches.
+                    template <typename T>
+                    inline T round_nearest(T y, T down, T half, bool tie_up, bool tie_to_even)
+                    {
+                        T mid = down + static_cast<T>(0.5);
+                        bool odd = half + half != down;
+                        bool up = (y != down) &
+                                  ((y > mid) | ((y == mid) & (tie_up | (tie_to_even & odd))));
+                        return down + (up ? static_cast<T>(1) : static_cast<T>(0));
+                    }
+
+                    template <op::Quantize::RoundMode MODE, typename T>
+                    inline T round_value(T x, T y, T down, T half)
+                    {
+                        typedef op::Quantize::RoundMode RoundMode;
+                        T r = down;
+                        switch (MODE)
+                        {
+                        case RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+                        case RoundMode::ROUND_NEAREST_UPWARD:
+                            r = round_nearest(y, down, half, true, false);
+                            break;
+                        case RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+                        case RoundMode::ROUND_NEAREST_DOWNWARD:
+                            r = round_nearest(y, down, half, false, false);
+                            break;
+                        case RoundMode::ROUND_NEAREST_TOWARD_EVEN:
+                            r = round_nearest(y, down, half, false, true);
+                            break;
+                        case RoundMode::ROUND_TOWARD_INFINITY:
+                        case RoundMode::ROUND_UP: r = -down; break;
+                        case RoundMode::ROUND_TOWARD_ZERO:
+                        case RoundMode::ROUND_DOWN: break;
+                        }
+                        switch (MODE)
+                        {
+                        case RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+                        case RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+                        case RoundMode::ROUND_TOWARD_INFINITY:
+                        case RoundMode::ROUND_TOWARD_ZERO: return x < 0 ? -r : r;
+                        default: return r;
+                        }
+                    }
+
+                    // The round mode and the scale layout are template parameters so that the
+                    // loops have no branches left and vectorize. Elements are processed in
+                    // chunks that stay in L1 between the passes.
+                    template <op::Quantize::RoundMode MODE,
+                              bool PER_ELEMENT,
+                              typename REAL,
+                              typename QUANT>
+                    void quantize_block(const REAL* input,
+                                        const REAL* scale,
+                                        const QUANT* zero_point,
+                                        QUANT* output,
+                                        size_t count)
+                    {
+                        const REAL min_value = static_cast<REAL>(std::numeric_limits<QUANT>::min());
+                        const REAL max_value = static_cast<REAL>(std::numeric_limits<QUANT>::max());
+                        const size_t chunk = 256;
+                        REAL x[chunk], y[chunk], down[chunk], half[chunk];
+                        for (size_t first = 0; first < count; first += chunk)
+                        {
+                            size_t n = std::min(chunk, count - first);
+                            for (size_t i = 0; i < n; i++)
+                            {
+                                size_t c = PER_ELEMENT ? first + i : 0;
+                                x[i] = input[first + i] / scale[c];
+                                y[i] = floor_argument<MODE>(x[i]);
+                            }
+                            typedef Eigen::TensorMap<Eigen::Tensor<REAL, 1, Eigen::RowMajor>> Map;
+                            Map y_map(y, n), down_map(down, n), half_map(half, n);
+                            down_map = y_map.floor();
+                            if (MODE == op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN)
+                            {
+                                half_map = (down_map * static_cast<REAL>(0.5)).floor();
+                            }
+                            for (size_t i = 0; i < n; i++)
+                            {
+                                size_t c = PER_ELEMENT ? first + i : 0;
+                                REAL qvalue = round_value<MODE>(x[i], y[i], down[i], half[i]);
+                                qvalue += zero_point[c];
+                                qvalue = std::max<REAL>(qvalue, min_value);
+                                qvalue = std::min<REAL>(qvalue, max_value);
+                                output[first + i] = static_cast<QUANT>(qvalue);
+                            }
+                        }
+                    }
+
+                    template <op::Quantize::RoundMode MODE, typename REAL, typename QUANT>
+                    void quantize(const REAL* input,
+                                  const REAL* scale,
+                                  const QUANT* zero_point,
+                                  QUANT* output,
+                                  const Shape& input_shape,
+                                  const Shape& scale_zero_point_shape,
+                                  const AxisSet& axes,
+                                  int arena)
+                    {
+                        ScaleLayout layout(input_shape, scale_zero_point_shape, axes);
+                        auto run = [&](size_t first, size_t count, size_t c) {
+                            if (layout.is_per_element())
+                            {
+                                quantize_block<MODE, true>(input + first,
+                                                           scale + c,
+                                                           zero_point + c,
+                                                           output + first,
+                                                           count);
+                            }
+                            else
+                            {
+                                quantize_block<MODE, false>(input + first,
+                                                            scale + c,
+                                                            zero_point + c,
+                                                            output + first,
+                                                            count);
+                            }
+                        };
+                        for_each_block(layout,
+                                       shape_size(input_shape),
+                                       Eigen::TensorOpCost(sizeof(REAL), sizeof(QUANT), 8),
+                                       run,
+                                       arena);
+                    }
+
+                    template <bool PER_ELEMENT, typename QUANT, typename REAL>
+                    void dequantize_block(const QUANT* input,
+                                          const REAL* scale,
+                                          const QUANT* zero_point,
+                                          REAL* output,
+                                          size_t count)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            size_t c = PER_ELEMENT ? i : 0;
+                            output[i] = static_cast<REAL>((input[i] - zero_point[c])) * scale[c];
+                        }
+                    }
+                }
+
+                // Same results as reference::quantize, computed in parallel blocks of
+                // contiguous elements. The one exception is double input just below a tie, e.g.
+                // 0.5 - 2^-54, which the reference rounds up because x + 0.5 rounds to 1.
+                template <typename REAL, typename QUANT>
+                void quantize(const REAL* input,
+                              const REAL* scale,
+                              const QUANT* zero_point,
+                              QUANT* output,
+                              const Shape& input_shape,
+                              const Shape& scale_zero_point_shape,
+                              const AxisSet& axes,
+                              op::Quantize::RoundMode round_mode,
+                              int arena)
+                {
+                    typedef op::Quantize::RoundMode RoundMode;
+#define QUANTIZE_ROUND_MODE(M)                                                                     \
+    case RoundMode::M:                                                                             \
+        quantize_detail::quantize<RoundMode::M>(                                                   \
+            input, scale, zero_point, output, input_shape, scale_zero_point_shape, axes, arena);   \
+        break;
+                    switch (round_mode)
+                    {
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_TOWARD_INFINITY)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_TOWARD_ZERO)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_UPWARD)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_DOWNWARD)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_TOWARD_EVEN)
+                        QUANTIZE_ROUND_MODE(ROUND_TOWARD_INFINITY)
+                        QUANTIZE_ROUND_MODE(ROUND_TOWARD_ZERO)
+                        QUANTIZE_ROUND_MODE(ROUND_UP)
+                        QUANTIZE_ROUND_MODE(ROUND_DOWN)
+                    }
+#undef QUANTIZE_ROUND_MODE
+                }
+
+                template <typename QUANT, typename REAL>
+                void dequantize(const QUANT* input,
+                                const REAL* scale,
+                                const QUANT* zero_point,
+                                REAL* output,
+                                const Shape& input_shape,
+                                const Shape& scale_zero_point_shape,
+                                const AxisSet& axes,
+                                int arena)
+                {
+                    quantize_detail::ScaleLayout layout(input_shape, scale_zero_point_shape, axes);
+                    auto run = [&](size_t first, size_t count, size_t c) {
+                        if (layout.is_per_element())
+                        {
+                            quantize_detail::dequantize_block<true>(
+                                input + first, scale + c, zero_point + c, output + first, count);
+                        }
+                        else
+                        {
+                            quantize_detail::dequantize_block<false>(
+                                input + first, scale + c, zero_point + c, output + first, count);
+                        }
+                    };
+                    quantize_detail::for_each_block(
+                        layout,
+                        shape_size(input_shape),
+                        Eigen::TensorOpCost(sizeof(QUANT), sizeof(REAL), 2),
+                        run,
+                        arena);
+                }
+            }
+        }
+    }
+}
@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -31,26 +36,138 @@ namespace ngraph
         {
             namespace kernel
             {
-                static void
-                    get_leading_indices(const Shape& shape, int index, std::vector<int>& indices)
+                // Accumulates num_updates rows of row_len elements from updates into out, update
+                // row r landing on output row row_index(r); out starts as a copy of inputs.
+                // Updates are grouped by destination row with a stable sort so that every output
+                // row is owned by one task and receives its updates in their original order. The
+                // result is deterministic and no atomics are needed. When only a few distinct rows
+                // are hit, rows are further split into column blocks to keep all threads busy.
+                template <typename ElementType, typename RowFunction>
+                void scatter_add_rows(const ElementType* inputs,
+                                      const ElementType* updates,
+                                      ElementType* out,
+                                      size_t num_out_rows,
+                                      size_t num_updates,
+                                      size_t row_len,
+                                      const RowFunction& row_index,
+                                      int arena)
                 {
-                    auto rank = shape.size();
-                    std::vector<int> partial_sum(rank);
+                    auto& executor = ngraph::runtime::cpu::executor::GetCPUExecutor();
+                    size_t row_bytes = row_len * sizeof(ElementType);
+                    if (inputs != out)
+                    {
+                        executor.parallel_for(
+                            arena,
+                            num_out_rows,
+                            Eigen::TensorOpCost(row_bytes, row_bytes, 0),
+                            [&](size_t first, size_t last) {
+                                memcpy(out + first * row_len,
+                                       inputs + first * row_len,
+                                       (last - first) * row_bytes);
+                            });
+                    }
+                    if (num_updates == 0 || row_len == 0)
+                    {
+                        return;
+                    }
 
-                    partial_sum[rank - 1] = 1;
-                    for (int j = rank - 2; j >= 0; j--)
+                    // order lists the updates grouped by destination row, in their original order
+                    // within a group. Group g covers order[group_begin[g], group_begin[g + 1]).
+                    std::vector<size_t> order(num_updates);
+                    std::vector<size_t> group_begin;
+                    std::vector<size_t> group_row;
+                    if (num_out_rows <= 2 * num_updates)
+                    {
+                        // Dense: counting sort over all output rows
+                        std::vector<size_t> dest(num_updates);
+                        std::vector<size_t> bucket(num_out_rows + 1, 0);
+                        for (size_t r = 0; r < num_updates; r++)
+                        {
+                            dest[r] = row_index(r);
+                            bucket[dest[r] + 1]++;
+                        }
+                        for (size_t row = 0; row < num_out_rows; row++)
+                        {
+                            if (bucket[row + 1] != 0)
+                            {
+                                group_begin.push_back(bucket[row]);
+                                group_row.push_back(row);
+                            }
+                            bucket[row + 1] += bucket[row];
+                        }
+                        for (size_t r = 0; r < num_updates; r++)
+                        {
+                            order[bucket[dest[r]]++] = r;
+                        }
+                    }
+                    else
                     {
-                        partial_sum[j] = partial_sum[j + 1] * shape[j + 1];
+                        // Sparse: sort (row, update) pairs so the cost does not depend on the
+                        // size of the output
+                        std::vector<std::pair<size_t, size_t>> keyed(num_updates);
+                        for (size_t r = 0; r < num_updates; r++)
+                        {
+                            keyed[r] = std::make_pair(static_cast<size_t>(row_index(r)), r);
+                        }
+                        std::sort(keyed.begin(), keyed.end());
+                        for (size_t i = 0; i < num_updates; i++)
+                        {
+                            if (i == 0 || keyed[i].first != keyed[i - 1].first)
+                            {
+                                group_begin.push_back(i);
+                                group_row.push_back(keyed[i].first);
+                            }
+                            order[i] = keyed[i].second;
+                        }
                     }
-                    for (int j = 0; j < rank; j++)
+                    size_t num_groups = group_row.size();
+                    group_begin.push_back(num_updates);
+
+                    const size_t min_block_len = 256;
+                    size_t threads =
+                        static_cast<size_t>(std::max(1, executor.get_num_threads_per_pool()));
+                    size_t col_blocks = 1;
+                    if (num_groups < threads)
                     {
-                        indices[j] = index / partial_sum[j];
-                        index = index % partial_sum[j];
+                        col_blocks = std::max<size_t>(
+                            1,
+                            std::min((threads + num_groups - 1) / num_groups,
+                                     row_len / min_block_len));
                     }
+
+                    auto accumulate = [&](size_t first, size_t last) {
+                        for (size_t i = first; i < last; i++)
+                        {
+                            size_t g = i / col_blocks;
+                            size_t block = i % col_blocks;
+                            size_t col_begin = block * row_len / col_blocks;
+                            size_t col_end = (block + 1) * row_len / col_blocks;
+                            ElementType* dst = out + group_row[g] * row_len;
+                            for (size_t u = group_begin[g]; u < group_begin[g + 1]; u++)
+                            {
+                                const ElementType* src = updates + order[u] * row_len;
+                                for (size_t c = col_begin; c < col_end; c++)
+                                {
+                                    dst[c] += src[c];
+                                }
+                            }
+                        }
+                    };
+                    size_t block_len = row_len / col_blocks;
+                    size_t updates_per_group = num_updates / num_groups;
+                    executor.parallel_for(
+                        arena,
+                        num_groups * col_blocks,
+                        Eigen::TensorOpCost(
+                            (updates_per_group + 1) * block_len * sizeof(ElementType),
+                            block_len * sizeof(ElementType),
+                            updates_per_group * block_len),
+                        accumulate);
                 }
 
                 // ScatterAdd is to update bunch of slices of the inputs. The rank of slice is 1
-                // less than the rank of the inputs.
+                // less than the rank of the inputs. Each slice is one row of the inputs viewed as
+                // [inputs_shape[0], rest]; the ranks are kept for the code generator.
                 template <typename ElementType,
                           typename IndicesType,
                           unsigned int Rank1,
@@ -64,69 +181,17 @@ namespace ngraph
                                  const Shape& updates_shape,
                                  int arena)
                 {
-                    // For Eigen slice op, both parameters (offsets and extents) need to have the
-                    // same rank.
-                    // Here *_offsets and *_extents have the same rank.
-                    Eigen::array<Eigen::Index, Rank1> in_dims, in_extents, in_offsets;
-                    Eigen::array<Eigen::Index, Rank2> updates_dims, updates_extents,
-                        updates_offsets;
-
-                    for (int i = 0; i < Rank1; i++)
-                    {
-                        in_extents[i] = in_dims[i] = inputs_shape[i];
-                        in_offsets[i] = 0;
-                    }
-                    in_extents[0] = 1;
-                    for (int i = 0; i < Rank2; i++)
-                    {
-                        updates_extents[i] = updates_dims[i] = updates_shape[i];
-                        updates_offsets[i] = 0;
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank1, Eigen::RowMajor>> out(
-                        static_cast<ElementType*>(output), in_dims);
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank1, Eigen::RowMajor>> in(
-                        static_cast<ElementType*>(inputs), in_dims);
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank2, Eigen::RowMajor>> up(
-                        static_cast<ElementType*>(updates), updates_dims);
-
-                    // copy if not in place.
-                    if (inputs != output)
-                    {
-                        out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                            arena)) = in;
-                    }
-
                     auto indices_ptr = static_cast<IndicesType*>(indices);
-                    auto indices_rank = indices_shape.size();
-                    if (indices_rank == 0)
-                    {
-                        in_offsets[0] = indices_ptr[0];
-                        out.slice(in_offsets, in_extents)
-                            .device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                arena)) =
-                            out.slice(in_offsets, in_extents) +
-                            up.slice(updates_offsets, updates_extents).reshape(in_extents);
-                    }
-                    else
-                    {
-                        std::vector<int> leading_indices(indices_rank);
-                        for (int i = 0; i < shape_size(indices_shape); i++)
-                        {
-                            in_offsets[0] = indices_ptr[i];
-                            get_leading_indices(indices_shape, i, leading_indices);
-                            for (int j = 0; j < indices_rank; j++)
-                            {
-                                updates_extents[j] = 1;
-                                updates_offsets[j] = leading_indices[j];
-                            }
-                            out.slice(in_offsets, in_extents)
-                                .device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                    arena)) =
-                                out.slice(in_offsets, in_extents) +
-                                up.slice(updates_offsets, updates_extents).reshape(in_extents);
-                        }
-                    }
+                    size_t slice_size =
+                        shape_size(Shape(inputs_shape.begin() + 1, inputs_shape.end()));
+                    scatter_add_rows(static_cast<ElementType*>(inputs),
+                                     static_cast<ElementType*>(updates),
+                                     static_cast<ElementType*>(output),
+                                     inputs_shape[0],
+                                     shape_size(indices_shape),
+                                     slice_size,
+                                     [&](size_t r) { return static_cast<size_t>(indices_ptr[r]); },
+                                     arena);
                 }
 
                 template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
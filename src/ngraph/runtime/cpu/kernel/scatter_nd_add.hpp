@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/cpu/kernel/scatter_add.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Each vector along the last axis of indices addresses a slice of the inputs by
+                // its leading coordinates. The slices are contiguous, so they are accumulated as
+                // rows of the inputs viewed as [slices, slice_size].
+                template <typename T, typename U>
+                void scatter_nd_add(const T* inputs,
+                                    const U* indices,
+                                    const T* updates,
+                                    T* out,
+                                    const Shape& inputs_shape,
+                                    const Shape& indices_shape,
+                                    int arena)
+                {
+                    size_t slice_rank = indices_shape.back();
+                    size_t num_updates =
+                        shape_size(Shape(indices_shape.begin(), indices_shape.end() - 1));
+                    Shape leading_shape(inputs_shape.begin(), inputs_shape.begin() + slice_rank);
+                    size_t slice_size =
+                        shape_size(Shape(inputs_shape.begin() + slice_rank, inputs_shape.end()));
+                    std::vector<size_t> leading_strides = row_major_strides(leading_shape);
+                    scatter_add_rows(inputs,
+                                     updates,
+                                     out,
+                                     shape_size(leading_shape),
+                                     num_updates,
+                                     slice_size,
+                                     [&](size_t r) {
+                                         const U* index = indices + r * slice_rank;
+                                         size_t row = 0;
+                                         for (size_t i = 0; i < slice_rank; i++)
+                                         {
+                                             row += static_cast<size_t>(index[i]) *
+                                                    leading_strides[i];
+                                         }
+                                         return row;
+                                     },
+                                     arena);
+                }
+            }
+        }
+    }
+}
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -52,117 +55,227 @@ namespace ngraph
                         out * out.sum().inverse().eval().reshape(rdims).broadcast(in_dims);
                 }
 
-                template <typename ElementType, unsigned int Rank, unsigned int AxisCount>
-                void softmax(void* input,
-                             void* output,
-                             const Shape& input_shape,
-                             const AxisSet& softmax_axes,
-                             int arena)
+                namespace softmax_detail
                 {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims, bcast;
-                    Eigen::array<Eigen::Index, AxisCount> axes;
-                    rdims.fill(1);
-
-                    for (int i = 0; i < Rank; i++)
+                    // Softmax over any set of axes, seen as rows of reduced elements. Adjacent
+                    // axes of the same kind are merged first. When the innermost axis is kept,
+                    // the elements of a row are processed as vectors of lanes along it.
+                    class StridedLayout
                     {
-                        in_dims[i] = input_shape[i];
-                    }
-
-                    for (int i = 0; i < Rank; i++)
-                    {
-                        if (softmax_axes.count(i))
+                    public:
+                        StridedLayout(const Shape& shape, const AxisSet& axes)
+                            : m_lanes(1)
+                            , m_contiguous(false)
+                            , m_reduce_offsets(1, 0)
                         {
-                            rdims[i] = 1;
+                            std::vector<size_t> sizes, strides;
+                            std::vector<bool> reduced;
+                            size_t stride = shape_size(shape);
+                            for (size_t i = 0; i < shape.size(); i++)
+                            {
+                                stride /= shape[i];
+                                if (shape[i] == 1)
+                                {
+                                    continue;
+                                }
+                                bool is_reduced = axes.count(i) != 0;
+                                if (!reduced.empty() && reduced.back() == is_reduced)
+                                {
+                                    sizes.back() *= shape[i];
+                                    strides.back() = stride;
+                                }
+                                else
+                                {
+                                    sizes.push_back(shape[i]);
+                                    strides.push_back(stride);
+                                    reduced.push_back(is_reduced);
+                                }
+                            }
+                            if (reduced.empty())
+                            {
+                                return;
+                            }
+                            if (!reduced.back())
+                            {
+                                m_lanes = sizes.back();
+                                sizes.pop_back();
+                                strides.pop_back();
+                                reduced.pop_back();
+                            }
+
+                            size_t reduced_dims = 0;
+                            for (size_t i = 0; i < sizes.size(); i++)
+                            {
+                                if (reduced[i])
+                                {
+                                    std::vector<size_t> offsets;
+                                    offsets.reserve(m_reduce_offsets.size() * sizes[i]);
+                                    for (size_t offset : m_reduce_offsets)
+                                    {
+                                        for (size_t j = 0; j < sizes[i]; j++)
+                                        {
+                                            offsets.push_back(offset + j * strides[i]);
+                                        }
+                                    }
+                                    m_reduce_offsets.swap(offsets);
+                                    reduced_dims++;
+                                }
+                                else
+                                {
+                                    m_row_sizes.push_back(sizes[i]);
+                                    m_row_strides.push_back(strides[i]);
+                                }
+                            }
+                            m_contiguous = m_lanes == 1 && reduced_dims == 1 && reduced.back();
                         }
-                        else
+
+                        size_t get_lanes() const { return m_lanes; }
+                        size_t get_row_count() const { return shape_size(m_row_sizes); }
+                        size_t get_row_size() const { return m_reduce_offsets.size(); }
+                        // True when the elements of a row are consecutive in memory
+                        bool is_contiguous() const { return m_contiguous; }
+                        const std::vector<size_t>& get_reduce_offsets() const
                         {
-                            rdims[i] = in_dims[i];
+                            return m_reduce_offsets;
                         }
-                    }
-                    for (int i = 0; i < Rank; i++)
-                    {
-                        bcast[i] = in_dims[i] / rdims[i];
-                    }
 
-                    int i = 0;
-                    for (auto axis : softmax_axes)
-                    {
-                        axes[i++] = axis;
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType *>(output), in_dims),
-                        in(static_cast<ElementType *>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum(axes).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum(axes).inverse().eval().reshape(rdims).broadcast(bcast);
-                }
+                        size_t row_offset(size_t row) const
+                        {
+                            size_t offset = 0;
+                            for (size_t d = m_row_sizes.size(); d-- > 0;)
+                            {
+                                offset += (row % m_row_sizes[d]) * m_row_strides[d];
+                                row /= m_row_sizes[d];
+                            }
+                            return offset;
+                        }
 
-                template <typename ElementType, unsigned int Rank>
-                void softmax_innermost_1rd(void* input,
-                                           void* output,
-                                           const Shape& input_shape,
-                                           int arena)
-                {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims, bcast;
-                    Eigen::IndexList<Eigen::type2index<Rank - 1>> axis;
-                    rdims.fill(1);
+                    private:
+                        size_t m_lanes;
+                        bool m_contiguous;
+                        Shape m_row_sizes;
+                        std::vector<size_t> m_row_strides;
+                        std::vector<size_t> m_reduce_offsets;
+                    };
 
-                    for (int i = 0; i < Rank; i++)
-                    {
-                        in_dims[i] = input_shape[i];
-                    }
+                    template <typename ElementType>
+                    using VectorMap =
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>>;
 
-                    for (int i = 0; i < Rank - 1; i++)
+                    // Softmax of n consecutive elements, in and out may alias
+                    template <typename ElementType>
+                    void softmax_row(ElementType* in, ElementType* out, size_t n)
                     {
-                        rdims[i] = in_dims[i];
+                        VectorMap<ElementType> x(in, n), y(out, n);
+                        Eigen::TensorFixedSize<ElementType, Eigen::Sizes<>, Eigen::RowMajor> max,
+                            sum;
+                        max = x.maximum();
+                        y = (x - x.constant(max())).exp();
+                        sum = y.sum();
+                        y = y * y.constant(1 / sum());
                     }
 
-                    for (int i = 0; i < Rank; i++)
+                    // Softmax of lanes vectors spaced by the reduce offsets, with running
+                    // maxima and sums kept per lane
+                    template <typename ElementType>
+                    void softmax_lanes(ElementType* in,
+                                       ElementType* out,
+                                       const std::vector<size_t>& offsets,
+                                       size_t lanes,
+                                       ElementType* max_buffer,
+                                       ElementType* sum_buffer)
                     {
-                        bcast[i] = in_dims[i] / rdims[i];
+                        VectorMap<ElementType> max(max_buffer, lanes), sum(sum_buffer, lanes);
+                        max = VectorMap<ElementType>(in + offsets[0], lanes);
+                        for (size_t i = 1; i < offsets.size(); i++)
+                        {
+                            max = max.cwiseMax(VectorMap<ElementType>(in + offsets[i], lanes));
+                        }
+                        sum.setZero();
+                        for (size_t offset : offsets)
+                        {
+                            VectorMap<ElementType> x(in + offset, lanes), y(out + offset, lanes);
+                            y = (x - max).exp();
+                            sum += y;
+                        }
+                        sum = sum.inverse();
+                        for (size_t offset : offsets)
+                        {
+                            VectorMap<ElementType> y(out + offset, lanes);
+                            y = y * sum;
+                        }
                     }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType *>(output), in_dims),
-                        in(static_cast<ElementType *>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum(axis).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum(axis).inverse().eval().reshape(rdims).broadcast(bcast);
-                }
-
-                template <typename ElementType, unsigned int Rank>
-                void softmax_1rd(void* input,
-                                 void* output,
-                                 const Shape& input_shape,
-                                 const AxisSet& softmax_axes,
-                                 int arena)
-                {
-                    softmax<ElementType, Rank, 1>(input, output, input_shape, softmax_axes, arena);
                 }
 
+                // Softmax over any axes with rows of the reduction spread across the thread pool
                 template <typename ElementType>
-                void softmax_3d_2rd(void* input,
-                                    void* output,
-                                    const Shape& input_shape,
-                                    const AxisSet& softmax_axes,
-                                    int arena)
+                void softmax_strided(void* input,
+                                     void* output,
+                                     const Shape& input_shape,
+                                     const AxisSet& softmax_axes,
+                                     int arena)
                 {
-                    softmax<ElementType, 3, 2>(input, output, input_shape, softmax_axes, arena);
-                }
+                    if (shape_size(input_shape) == 0)
+                    {
+                        return;
+                    }
+                    auto in = static_cast<ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    softmax_detail::StridedLayout layout(input_shape, softmax_axes);
+                    const std::vector<size_t>& offsets = layout.get_reduce_offsets();
+                    size_t row_size = layout.get_row_size();
 
-                template <typename ElementType>
-                void softmax_4d_3rd(void* input,
-                                    void* output,
-                                    const Shape& input_shape,
-                                    const AxisSet& softmax_axes,
-                                    int arena)
-                {
-                    softmax<ElementType, 4, 3>(input, output, input_shape, softmax_axes, arena);
+                    // Lanes are split into blocks that keep a row block in cache
+                    const size_t max_block = 256;
+                    size_t lanes = layout.get_lanes();
+                    size_t blocks = (lanes + max_block - 1) / max_block;
+                    size_t block = (lanes + blocks - 1) / blocks;
+
+                    auto run = [&](size_t first, size_t last) {
+                        std::vector<ElementType> buffer(lanes == 1 ? row_size : 2 * block);
+                        for (size_t i = first; i < last; i++)
+                        {
+                            size_t row = i / blocks;
+                            size_t lane = (i % blocks) * block;
+                            size_t base = layout.row_offset(row) + lane;
+                            if (layout.is_contiguous())
+                            {
+                                softmax_detail::softmax_row<ElementType>(
+                                    in + base, out + base, row_size);
+                            }
+                            else if (lanes == 1)
+                            {
+                                for (size_t j = 0; j < row_size; j++)
+                                {
+                                    buffer[j] = in[base + offsets[j]];
+                                }
+                                softmax_detail::softmax_row<ElementType>(
+                                    buffer.data(), buffer.data(), row_size);
+                                for (size_t j = 0; j < row_size; j++)
+                                {
+                                    out[base + offsets[j]] = buffer[j];
+                                }
+                            }
+                            else
+                            {
+                                softmax_detail::softmax_lanes<ElementType>(
+                                    in + base,
+                                    out + base,
+                                    offsets,
+                                    std::min(block, lanes - lane),
+                                    buffer.data(),
+                                    buffer.data() + block);
+                            }
+                        }
+                    };
+                    size_t item_size = row_size * std::min(block, lanes);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().parallel_for(
+                        arena,
+                        layout.get_row_count() * blocks,
+                        Eigen::TensorOpCost(3 * item_size * sizeof(ElementType),
+                                            2 * item_size * sizeof(ElementType),
+                                            20 * item_size),
+                        run);
                 }
             }
         }
@@ -0,0 +1,215 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace topk_detail
+                {
+                    // Elements are scanned in blocks of this size. A block is only looked at
+                    // element by element if one of its values beats the current k-th best, and
+                    // that test is a simple reduction the compiler vectorizes.
+                    constexpr size_t block_size = 16;
+
+                    template <typename T, bool COMPUTE_MAX>
+                    inline bool beats(T value, T threshold)
+                    {
+                        return COMPUTE_MAX ? value > threshold : value < threshold;
+                    }
+
+                    template <typename T, typename U, bool COMPUTE_MAX>
+                    inline bool better(const std::tuple<T, U>& a, const std::tuple<T, U>& b)
+                    {
+                        return COMPUTE_MAX ? reference::compare_max<T, U>(a, b)
+                                           : reference::compare_min<T, U>(a, b);
+                    }
+
+                    // Selects the k best of the n contiguous values in row and writes them,
+                    // best first, to out_indices and out_values with stride out_stride.
+                    // Small k keeps a heap of the k best with the worst on top; elements can
+                    // only enter it by beating the top, since ties go to the lower index.
+                    // Larger k selects with nth_element and sorts the selected prefix.
+                    template <typename T, typename U, bool COMPUTE_MAX>
+                    void select_row(const T* row,
+                                    size_t n,
+                                    size_t k,
+                                    U* out_indices,
+                                    T* out_values,
+                                    size_t out_stride,
+                                    std::vector<std::tuple<T, U>>& workspace)
+                    {
+                        auto cmp = [](const std::tuple<T, U>& a, const std::tuple<T, U>& b) {
+                            return better<T, U, COMPUTE_MAX>(a, b);
+                        };
+                        workspace.clear();
+                        if (k * 8 < n)
+                        {
+                            size_t i = 0;
+                            for (; i < k; i++)
+                            {
+                                workspace.emplace_back(row[i], static_cast<U>(i));
+                            }
+                            std::make_heap(workspace.begin(), workspace.end(), cmp);
+                            T threshold = std::get<0>(workspace.front());
+                            auto offer = [&](size_t j) {
+                                if (beats<T, COMPUTE_MAX>(row[j], threshold))
+                                {
+                                    std::pop_heap(workspace.begin(), workspace.end(), cmp);
+                                    workspace.back() =
+                                        std::make_tuple(row[j], static_cast<U>(j));
+                                    std::push_heap(workspace.begin(), workspace.end(), cmp);
+                                    threshold = std::get<0>(workspace.front());
+                                }
+                            };
+                            for (; i + block_size <= n; i += block_size)
+                            {
+                                bool any = false;
+                                for (size_t j = 0; j < block_size; j++)
+                                {
+                                    any |= beats<T, COMPUTE_MAX>(row[i + j], threshold);
+                                }
+                                if (any)
+                                {
+                                    for (size_t j = i; j < i + block_size; j++)
+                                    {
+                                        offer(j);
+                                    }
+                                }
+                            }
+                            for (; i < n; i++)
+                            {
+                                offer(i);
+                            }
+                            std::sort_heap(workspace.begin(), workspace.end(), cmp);
+                        }
+                        else
+                        {
+                            for (size_t i = 0; i < n; i++)
+                            {
+                                workspace.emplace_back(row[i], static_cast<U>(i));
+                            }
+                            if (k < n)
+                            {
+                                std::nth_element(workspace.begin(),
+                                                 workspace.begin() + k,
+                                                 workspace.end(),
+                                                 cmp);
+                            }
+                            std::sort(workspace.begin(), workspace.begin() + k, cmp);
+                        }
+                        for (size_t j = 0; j < k; j++)
+                        {
+                            out_values[j * out_stride] = std::get<0>(workspace[j]);
+                            out_indices[j * out_stride] = std::get<1>(workspace[j]);
+                        }
+                    }
+
+                    template <typename T, typename U, bool COMPUTE_MAX>
+                    void topk(const T* arg,
+                              U* out_indices,
+                              T* out_values,
+                              const Shape& in_shape,
+                              size_t axis,
+                              size_t k,
+                              int arena)
+                    {
+                        size_t outer = shape_size(Shape(in_shape.begin(), in_shape.begin() + axis));
+                        size_t inner =
+                            shape_size(Shape(in_shape.begin() + axis + 1, in_shape.end()));
+                        size_t n = in_shape[axis];
+                        if (k == 0 || outer * inner == 0)
+                        {
+                            return;
+                        }
+
+                        // One task per slice along axis. Strided slices are copied into a
+                        // contiguous buffer first so that every slice takes the same path.
+                        auto select_slices = [&](size_t first, size_t last) {
+                            std::vector<std::tuple<T, U>> workspace;
+                            std::vector<T> row(inner == 1 ? 0 : n);
+                            for (size_t slice = first; slice < last; slice++)
+                            {
+                                size_t o = slice / inner;
+                                size_t i = slice % inner;
+                                const T* in = arg + o * n * inner + i;
+                                if (inner != 1)
+                                {
+                                    for (size_t j = 0; j < n; j++)
+                                    {
+                                        row[j] = in[j * inner];
+                                    }
+                                    in = row.data();
+                                }
+                                size_t out_offset = o * k * inner + i;
+                                select_row<T, U, COMPUTE_MAX>(in,
+                                                              n,
+                                                              k,
+                                                              out_indices + out_offset,
+                                                              out_values + out_offset,
+                                                              inner,
+                                                              workspace);
+                            }
+                        };
+                        executor::GetCPUExecutor().parallel_for(
+                            arena,
+                            outer * inner,
+                            Eigen::TensorOpCost(n * sizeof(T),
+                                                k * (sizeof(T) + sizeof(U)),
+                                                n * (k * 8 < n ? 2.0 : 8.0)),
+                            select_slices);
+                    }
+                }
+
+                template <typename T, typename U>
+                void topk(const T* arg,
+                          U* out_indices,
+                          T* out_values,
+                          const Shape& in_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max,
+                          int arena)
+                {
+                    if (compute_max)
+                    {
+                        topk_detail::topk<T, U, true>(
+                            arg, out_indices, out_values, in_shape, axis, k, arena);
+                    }
+                    else
+                    {
+                        topk_detail::topk<T, U, false>(
+                            arg, out_indices, out_values, in_shape, axis, k, arena);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -799,23 +799,10 @@ namespace ngraph
                     {
                         return;
                     }
-                    if (node->get_input_element_type(0) == element::u8)
+                    // MKLDNN has no offset, so the offsets of all channels have to be zero
+                    if (!ngraph::is_zero(offset_const_op))
                     {
-                        auto offset = offset_const_op->get_vector<uint8_t>();
-                        if (offset[0] != 0)
-                            return;
-                    }
-                    if (node->get_input_element_type(0) == element::i8)
-                    {
-                        auto offset = offset_const_op->get_vector<int8_t>();
-                        if (offset[0] != 0)
-                            return;
-                    }
-                    if (node->get_input_element_type(0) == element::i32)
-                    {
-                        auto offset = offset_const_op->get_vector<int32_t>();
-                        if (offset[0] != 0)
-                            return;
+                        return;
                     }
                     runtime::cpu::mkldnn_utils::assign_mkldnn_kernel(node);
                 }
@@ -842,29 +829,9 @@ namespace ngraph
                     {
                         return;
                     }
-                    if (node->get_output_element_type(0) == element::u8)
-                    {
-                        auto offset = offset_const_op->get_vector<uint8_t>();
-                        if (offset[0] != 0)
-                        {
-                            return;
-                        }
-                    }
-                    if (node->get_output_element_type(0) == element::i8)
+                    if (!ngraph::is_zero(offset_const_op))
                     {
-                        auto offset = offset_const_op->get_vector<int8_t>();
-                        if (offset[0] != 0)
-                        {
-                            return;
-                        }
-                    }
-                    if (node->get_output_element_type(0) == element::i32)
-                    {
-                        auto offset = offset_const_op->get_vector<int32_t>();
-                        if (offset[0] != 0)
-                        {
-                            return;
-                        }
+                        return;
                     }
                     runtime::cpu::mkldnn_utils::assign_mkldnn_kernel(node);
                 }
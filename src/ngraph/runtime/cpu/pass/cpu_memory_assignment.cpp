@@ -56,7 +56,7 @@ size_t runtime::cpu::pass::CPUMemoryAssignment::get_bufferID(descriptor::Tensor*
 }
 
 void runtime::cpu::pass::CPUMemoryAssignment::process_in_place_concat(
-    std::list<std::shared_ptr<Node>> nodes)
+    std::vector<std::shared_ptr<Node>> nodes)
 {
     for (shared_ptr<Node> node : nodes)
     {
@@ -234,7 +234,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::propagate_in_place_concat(
 
 // slice
 void runtime::cpu::pass::CPUMemoryAssignment::process_in_place_slice(
-    std::list<std::shared_ptr<Node>> nodes)
+    std::vector<std::shared_ptr<Node>> nodes)
 {
     for (shared_ptr<Node>& node : nodes)
     {
@@ -356,7 +356,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::propagate_in_place_slice(
 // new set is created. bufferID_to_tensorSets maps bufferID to the pair of TensorRole and buffer
 // set. TensorRole is INPUT, CONSTANT, OUTPUT, or INTERMEDIATE, which tells from where the memory
 // buffer comes. tensor_to_bufferID maps tensor to the ID of the buffer set it belongs to.
-void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared_ptr<Node>>& ops)
+void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(vector<shared_ptr<Node>>& ops)
 {
     unordered_set<descriptor::Tensor*> in_place_slice_chain;
     size_t count = 0;
@@ -575,7 +575,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared
 }
 
 void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
-    std::list<std::shared_ptr<Node>>& ops)
+    std::vector<std::shared_ptr<Node>>& ops)
 {
     auto find_role = [](TensorRole tensor_role) -> string {
         switch (tensor_role)
@@ -650,15 +650,17 @@ void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
 
 bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph::Function> function)
 {
-    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    vector<shared_ptr<Node>> ops = function->get_ordered_ops();
 
     build_buffer_sets_maps(ops);
     liveness_analysis(ops);
 
     // memory assignment using liveness analysis result
 
-    // memory manager for non-cacheable ops, memory allocation will be freed when not longer in use
-    ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // planner for non-cacheable ops: lifetimes are collected for the whole function and the
+    // buffers are placed together once the walk below is done
+    ngraph::pass::MemoryPlanner planner(m_alignment);
+    unordered_map<descriptor::Tensor*, size_t> planned_buffers;
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
 
@@ -688,8 +690,10 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
+    size_t index = 0;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
+        index++;
         if (node->is_parameter() || node->is_constant() || node->is_output())
         {
             continue;
@@ -750,19 +754,12 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                         // buffer, do not reuse input buffer get the largest tensor size, which is
                         // the size of the memory buffer for the set
                         size_t input_size = input_tensor->size();
-                        // get the smallest offset, which is the offset of the memory buffer for the
-                        // set
-                        size_t offset = input_tensor->get_pool_offset();
                         for (auto e : input_set)
                         {
                             if (e->size() > input_size)
                             {
                                 input_size = e->size();
                             }
-                            if (e->get_pool_offset() < offset)
-                            {
-                                offset = e->get_pool_offset();
-                            }
                         }
                         auto output_buffer_it = m_bufferID_to_tensorSets.find(output_bufferID);
                         NGRAPH_CHECK(output_buffer_it != m_bufferID_to_tensorSets.end());
@@ -788,15 +785,22 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                         no_free.insert(input_tensor);
                         no_new.insert(output_tensor);
 
-                        // set the tensor offset for tensors in the set containing the output tensor
-                        // to the starting offset
-                        // of the set of input tensor.
+                        // place the tensors in the set containing the output tensor in the
+                        // buffer of the set of input tensor.
                         // do not combine those two sets.
                         // change the label of output tensor set to that of input tensor set
                         output_buffer_it->second.first = input_buffer_it->second.first;
+                        auto planned_it = planned_buffers.find(input_tensor);
                         for (auto& ele_t : output_set)
                         {
-                            ele_t->set_pool_offset(offset);
+                            if (planned_it != planned_buffers.end())
+                            {
+                                planned_buffers[ele_t] = planned_it->second;
+                            }
+                            else
+                            {
+                                ele_t->set_pool_offset(input_tensor->get_pool_offset());
+                            }
                         }
                     }
                 }
@@ -825,15 +829,20 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
             if (m_tensor_caching.count(tensor) != 0)
             {
                 offset = mm_caching.allocate(size);
+                tensor->set_pool_offset(offset);
+                for (auto& e : tensor_set)
+                {
+                    e->set_pool_offset(offset);
+                }
             }
             else
             {
-                offset = mm.allocate(size);
-            }
-            tensor->set_pool_offset(offset);
-            for (auto& e : tensor_set)
-            {
-                e->set_pool_offset(offset);
+                auto buffer = planner.add_buffer(size, index);
+                planned_buffers[tensor] = buffer;
+                for (auto& e : tensor_set)
+                {
+                    planned_buffers[e] = buffer;
+                }
             }
         }
 
@@ -846,15 +855,21 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                 {
                     continue;
                 }
-                if (m_tensor_caching.empty() ||
-                    (!m_tensor_caching.empty() && m_tensor_caching.count(tensor) == 0))
+                auto planned_it = planned_buffers.find(tensor);
+                if (m_tensor_caching.count(tensor) == 0 && planned_it != planned_buffers.end())
                 {
-                    mm.free(tensor->get_pool_offset());
+                    planner.set_last_use(planned_it->second, index);
                 }
             }
         }
     }
 
+    planner.plan();
+    for (auto& planned : planned_buffers)
+    {
+        planned.first->set_pool_offset(planner.get_offset(planned.second));
+    }
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -863,7 +878,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     process_in_place_slice(ops);
 
     // update the offset for intermediate tensors in tensor_caching
-    auto start = mm.max_allocated();
+    auto start = planner.peak();
     for (auto item : m_tensor_caching)
     {
         auto bufferID = get_bufferID(item);
@@ -877,13 +892,14 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
-    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << mm.max_allocated();
+    NGRAPH_DEBUG << "cpu_memory_assignment: planned peak is " << planner.peak()
+                 << ", lower bound is " << planner.lower_bound();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated for mm_caching is "
                  << mm_caching.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is "
-                 << mm.max_allocated() + mm_caching.max_allocated();
+                 << planner.peak() + mm_caching.max_allocated();
 
-    function->set_temporary_pool_size(mm.max_allocated() + mm_caching.max_allocated());
+    function->set_temporary_pool_size(planner.peak() + mm_caching.max_allocated());
 
     return false;
 }
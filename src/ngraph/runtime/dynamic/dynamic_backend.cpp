@@ -64,13 +64,22 @@ shared_ptr<runtime::Executable>
         function, m_wrapped_backend, enable_performance_collection);
 }
 
+constexpr size_t runtime::dynamic::DynamicExecutable::default_cache_capacity;
+
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
                                                        bool enable_performance_collection)
     : m_wrapped_function(wrapped_function)
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
+    , m_cache_capacity(default_cache_capacity)
 {
+    const auto env_cache_size = std::getenv("NGRAPH_DYNAMIC_EXECUTABLE_CACHE_SIZE");
+    if (env_cache_size != nullptr)
+    {
+        m_cache_capacity = std::strtoul(env_cache_size, nullptr, 10);
+    }
+
     pass::Manager passes;
     passes.register_pass<pass::ShapeRelevance>();
     passes.run_passes(m_wrapped_function);
@@ -98,22 +107,28 @@ static size_t count_dyn_nodes(const shared_ptr<ngraph::Function>& f)
     return count;
 }
 
+template <typename T>
+static void append_to_key(std::string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
 bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
-
     NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
 
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
     std::vector<element::Type> arg_element_types;
     std::vector<PartialShape> arg_shapes;
 
-    std::shared_ptr<Function> clone;
+    // The cache key is made of:
+    // (1) all element types and shapes;
+    // (2) all values of shape-relevant input tensors.
+    std::string key;
+
+    std::shared_ptr<CacheEntry> entry;
     {
         // We'll use AlignedBuffers to back the base pointers, storing them in this vector for RAII
         // purposes.
@@ -125,66 +140,128 @@ bool runtime::dynamic::DynamicExecutable::call(
 
         for (auto& input : inputs)
         {
+            if (auto dynamic_tensor =
+                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+            {
+                NGRAPH_CHECK(dynamic_tensor->has_storage());
+                arg_element_types.push_back(
+                    dynamic_tensor->get_wrapped_tensor()->get_element_type());
+                arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
+                wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
+            }
+            else
+            {
+                arg_element_types.push_back(input->get_element_type());
+                arg_shapes.push_back(input->get_shape());
+                wrapped_inputs.push_back(input);
+            }
+
+            const Shape& shape = wrapped_inputs.back()->get_shape();
+            append_to_key(key, static_cast<element::Type_t>(arg_element_types.back()));
+            append_to_key(key, shape.size());
+            for (size_t d : shape)
+            {
+                append_to_key(key, d);
+            }
+
             if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
             {
-                // TODO(amprocte): Move has_storage() to runtime::Tensor?
-                if (auto dynamic_tensor =
-                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                {
-                    NGRAPH_CHECK(dynamic_tensor->has_storage());
-                }
-
-                arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
+                size_t size_in_bytes = input->get_size_in_bytes();
+                arg_buffers.emplace_back(size_in_bytes, /*alignment=*/64);
                 arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
 
                 // TODO(amprocte): For host-resident tensors we should be able to skip the read,
                 // but no API for that yet.
-                input->read(arg_value_base_pointers[i], input->get_size_in_bytes());
+                input->read(arg_value_base_pointers[i], size_in_bytes);
+                key.append(static_cast<const char*>(arg_value_base_pointers[i]), size_in_bytes);
             }
             else
             {
                 arg_value_base_pointers[i] = nullptr;
             }
 
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+            i++;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_cache_mutex);
+            auto it = m_cache_map.find(key);
+            if (it != m_cache_map.end())
             {
-                NGRAPH_CHECK(dynamic_tensor->has_storage());
-                arg_element_types.push_back(
-                    dynamic_tensor->get_wrapped_tensor()->get_element_type());
-                arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
-                wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
+                m_cache_lru.splice(m_cache_lru.begin(), m_cache_lru, it->second);
+                entry = it->second->second;
+                m_cache_hits++;
             }
             else
             {
-                arg_element_types.push_back(input->get_element_type());
-                arg_shapes.push_back(input->get_shape());
-                wrapped_inputs.push_back(input);
+                m_cache_misses++;
             }
+        }
 
-            i++;
+        if (entry == nullptr)
+        {
+            entry = compile_specialized(arg_element_types, arg_shapes, arg_value_base_pointers);
+
+            std::lock_guard<std::mutex> guard(m_cache_mutex);
+            // Another thread may have compiled the same configuration in the meantime; keep
+            // whichever entry made it into the cache first.
+            if (m_cache_capacity > 0 && m_cache_map.find(key) == m_cache_map.end())
+            {
+                m_cache_lru.emplace_front(key, entry);
+                m_cache_map.emplace(std::move(key), m_cache_lru.begin());
+                evict_to_capacity();
+            }
         }
+    }
+
+    NGRAPH_CHECK(entry->m_result_shapes.size() == outputs.size());
+
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
 
-        clone = specialize_function(
-            m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
+        {
+            dynamic_tensor->make_storage(entry->m_result_element_types[i],
+                                         entry->m_result_shapes[i]);
+            wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
+        {
+            wrapped_outputs.push_back(outputs[i]);
+        }
     }
 
-    pass::Manager passes;
-    passes.register_pass<pass::ConstantFolding>();
-    passes.register_pass<pass::DynElimination>();
-    passes.set_per_pass_validation(false);
-
-    // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
-    // ConstantFolding/DynElimination until everything that DynElimination is supposed to
-    // eliminate has actually been eliminated. We could do this by monitoring the return values of
-    // of the passes (keep iterating until both CF and DE report no changes), but that did not
-    // seem to work so here we are. Probably a better fix is to somehow combine the matchers in CF
-    // and DE into one pass.
+    return entry->m_executable->call(wrapped_outputs, wrapped_inputs);
+}
+
+shared_ptr<runtime::dynamic::DynamicExecutable::CacheEntry>
+    runtime::dynamic::DynamicExecutable::compile_specialized(
+        const std::vector<element::Type>& arg_element_types,
+        const std::vector<PartialShape>& arg_shapes,
+        const std::vector<void*>& arg_value_base_pointers)
+{
+    std::shared_ptr<Function> clone = specialize_function(
+        m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+
+    // ConstantFolding and DynElimination feed each other: eliminating a Dyn op exposes new
+    // constant subgraphs and folding produces the constant arguments DynElimination needs. Run
+    // their matchers as one incremental rewrite so both reach a joint fixpoint in one pass.
+    pass::ConstantFolding constant_folding;
+    pass::DynElimination dyn_elimination;
+    pass::GraphRewrite rewrite;
+    rewrite.add_matchers(constant_folding);
+    rewrite.add_matchers(dyn_elimination);
+    rewrite.set_incremental(true);
+
+    // Kept as a safety net for rewrites that incremental matching does not see, e.g. callbacks
+    // that rewire inputs without replace_node.
     size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
 
     while (num_dyn_nodes_last_pass != 0)
     {
-        passes.run_passes(clone);
+        rewrite.run_on_function(clone);
         auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
 
         NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
@@ -199,7 +276,7 @@ bool runtime::dynamic::DynamicExecutable::call(
     pass_val.register_pass<pass::Validate>();
     pass_val.run_passes(clone);
 
-    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+    auto entry = make_shared<CacheEntry>();
 
     const ResultVector& results = clone->get_results();
     for (auto& result : results)
@@ -207,29 +284,59 @@ bool runtime::dynamic::DynamicExecutable::call(
         NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
                      "Shape staticization failed for result node ",
                      *result);
+        entry->m_result_element_types.push_back(result->get_output_element_type(0));
+        entry->m_result_shapes.push_back(result->get_output_shape(0));
     }
-    NGRAPH_CHECK(results.size() == outputs.size());
 
-    for (size_t i = 0; i < outputs.size(); i++)
+    entry->m_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
+    return entry;
+}
+
+void runtime::dynamic::DynamicExecutable::evict_to_capacity()
+{
+    while (m_cache_lru.size() > m_cache_capacity)
     {
-        if (auto dynamic_tensor =
-                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
-        {
-            dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                         results[i]->get_output_shape(0));
-            wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
-        }
-        else
-        {
-            wrapped_outputs.push_back(outputs[i]);
-        }
+        m_cache_map.erase(m_cache_lru.back().first);
+        m_cache_lru.pop_back();
     }
+}
+
+void runtime::dynamic::DynamicExecutable::set_cache_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> guard(m_cache_mutex);
+    m_cache_capacity = capacity;
+    evict_to_capacity();
+}
 
-    // TODO: Put compiled executable in the cache.
-    auto compiled_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
-    auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
+size_t runtime::dynamic::DynamicExecutable::get_cache_capacity() const
+{
+    std::lock_guard<std::mutex> guard(m_cache_mutex);
+    return m_cache_capacity;
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_size() const
+{
+    std::lock_guard<std::mutex> guard(m_cache_mutex);
+    return m_cache_lru.size();
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_hits() const
+{
+    std::lock_guard<std::mutex> guard(m_cache_mutex);
+    return m_cache_hits;
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_misses() const
+{
+    std::lock_guard<std::mutex> guard(m_cache_mutex);
+    return m_cache_misses;
+}
 
-    return result;
+void runtime::dynamic::DynamicExecutable::clear_cache()
+{
+    std::lock_guard<std::mutex> guard(m_cache_mutex);
+    m_cache_map.clear();
+    m_cache_lru.clear();
 }
 
 runtime::dynamic::DynamicTensor::DynamicTensor(
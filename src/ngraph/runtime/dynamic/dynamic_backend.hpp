@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/runtime/backend.hpp"
@@ -86,21 +89,67 @@ private:
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// Compiled clones are kept in a bounded LRU cache keyed on the input element
+/// types, the input shapes, and the values of all shape-relevant inputs, so
+/// steps 1 and 2 are skipped whenever a previously seen configuration recurs.
+/// The cache capacity defaults to `DynamicExecutable::default_cache_capacity`
+/// and may be overridden with the `NGRAPH_DYNAMIC_EXECUTABLE_CACHE_SIZE`
+/// environment variable or `set_cache_capacity()`. A capacity of zero disables
+/// caching.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
 {
 public:
+    static constexpr size_t default_cache_capacity = 100;
+
     DynamicExecutable(std::shared_ptr<Function> wrapped_function,
                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
                       bool enable_performance_collection = false);
+    ~DynamicExecutable() override { wait_for_async_calls(); }
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief Set the maximum number of compiled executables to keep. Shrinking the capacity
+    ///        evicts the least recently used entries immediately.
+    void set_cache_capacity(size_t capacity);
+    size_t get_cache_capacity() const;
+    /// \returns The number of compiled executables currently held in the cache.
+    size_t get_cache_size() const;
+    /// \returns The number of calls that reused a cached executable.
+    size_t get_cache_hits() const;
+    /// \returns The number of calls that had to specialize and compile the function.
+    size_t get_cache_misses() const;
+    /// \brief Drop all cached executables. Hit and miss counters are left untouched.
+    void clear_cache();
+
 private:
+    struct CacheEntry
+    {
+        std::shared_ptr<runtime::Executable> m_executable;
+        std::vector<element::Type> m_result_element_types;
+        std::vector<Shape> m_result_shapes;
+    };
+    using CacheList = std::list<std::pair<std::string, std::shared_ptr<CacheEntry>>>;
+
+    std::shared_ptr<CacheEntry>
+        compile_specialized(const std::vector<element::Type>& arg_element_types,
+                            const std::vector<PartialShape>& arg_shapes,
+                            const std::vector<void*>& arg_value_base_pointers);
+    void evict_to_capacity();
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     bool m_enable_performance_collection;
+
+    mutable std::mutex m_cache_mutex;
+    size_t m_cache_capacity;
+    size_t m_cache_hits{0};
+    size_t m_cache_misses{0};
+    // Most recently used entries are at the front.
+    CacheList m_cache_lru;
+    std::unordered_map<std::string, CacheList::iterator> m_cache_map;
 };
 
 ///
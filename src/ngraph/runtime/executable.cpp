@@ -30,6 +30,113 @@ runtime::Executable::Executable()
 
 runtime::Executable::~Executable()
 {
+    wait_for_async_calls();
+    if (m_async_worker.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_async_mutex);
+            m_async_stop = true;
+        }
+        m_async_worker_cv.notify_one();
+        m_async_worker.join();
+    }
+}
+
+future<bool> runtime::Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                             AsyncCallback callback)
+{
+    auto request = make_shared<AsyncRequest>();
+    request->m_outputs = outputs;
+    request->m_inputs = inputs;
+    request->m_callback = std::move(callback);
+    future<bool> result = request->m_promise.get_future();
+
+    std::lock_guard<std::mutex> lock(m_async_mutex);
+    m_async_queue.push_back(request);
+    schedule_async_calls();
+    return result;
+}
+
+void runtime::Executable::wait_for_async_calls()
+{
+    std::unique_lock<std::mutex> lock(m_async_mutex);
+    m_async_cv.wait(lock, [this]() { return m_async_in_flight == 0 && m_async_queue.empty(); });
+}
+
+// Must be called with m_async_mutex held
+void runtime::Executable::schedule_async_calls()
+{
+    while (m_async_in_flight < get_max_async_calls() && !m_async_queue.empty())
+    {
+        shared_ptr<AsyncRequest> request = m_async_queue.front();
+        m_async_queue.pop_front();
+        m_async_in_flight++;
+        dispatch_async([this, request]() { run_async_call(*request); });
+    }
+}
+
+void runtime::Executable::run_async_call(AsyncRequest& request)
+{
+    bool result = false;
+    exception_ptr error = nullptr;
+    try
+    {
+        result = call(request.m_outputs, request.m_inputs);
+    }
+    catch (...)
+    {
+        error = current_exception();
+    }
+
+    // Run the callback first so that its effects are visible to anyone waiting on the future
+    if (request.m_callback)
+    {
+        request.m_callback(result, error);
+    }
+    if (error)
+    {
+        request.m_promise.set_exception(error);
+    }
+    else
+    {
+        request.m_promise.set_value(result);
+    }
+
+    // Notify while holding the lock so that a waiter in the destructor cannot tear down the
+    // condition variable underneath us.
+    std::lock_guard<std::mutex> lock(m_async_mutex);
+    m_async_in_flight--;
+    schedule_async_calls();
+    m_async_cv.notify_all();
+}
+
+void runtime::Executable::dispatch_async(function<void()> task)
+{
+    m_async_tasks.push_back(std::move(task));
+    if (!m_async_worker.joinable())
+    {
+        m_async_worker = thread([this]() { async_worker_loop(); });
+    }
+    m_async_worker_cv.notify_one();
+}
+
+void runtime::Executable::async_worker_loop()
+{
+    std::unique_lock<std::mutex> lock(m_async_mutex);
+    while (true)
+    {
+        m_async_worker_cv.wait(lock, [this]() { return m_async_stop || !m_async_tasks.empty(); });
+        if (m_async_tasks.empty())
+        {
+            return;
+        }
+        function<void()> task = std::move(m_async_tasks.front());
+        m_async_tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
 }
 
 bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Tensor>>& outputs,
@@ -16,7 +16,14 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -51,6 +58,30 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Completion callback for call_async. Receives the value returned by call() and
+    ///        the exception it threw, if any (nullptr otherwise). Must not throw.
+    using AsyncCallback = std::function<void(bool, std::exception_ptr)>;
+
+    /// \brief Queues a single iteration of a Function for asynchronous execution.
+    ///
+    /// Calls submitted to the same Executable start in submission order. The tensors must stay
+    /// alive and unmodified until the call completes, and all pending calls must complete before
+    /// the Executable is destroyed.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \param callback optional function invoked on the executing thread on completion, before
+    ///                 the returned future becomes ready
+    /// \returns a future holding the value returned by call(), or the exception it threw
+    std::future<bool> call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                 AsyncCallback callback = nullptr);
+
+    /// \brief Blocks until every call submitted through call_async has completed.
+    ///
+    /// Pending calls run the derived call(), so every implementation must call this from its
+    /// own destructor; the base destructor runs too late to do so safely.
+    void wait_for_async_calls();
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
@@ -109,7 +140,40 @@ protected:
     /// \param func The function with Results fully resolved.
     void set_parameters_and_results(const Function& func);
 
+    /// \brief Runs a queued asynchronous call. The default implementation hands tasks to a
+    ///        worker thread owned by this Executable. Called with the submission queue locked,
+    ///        so implementations must not block or call back into call_async.
+    /// \param task The work to run
+    virtual void dispatch_async(std::function<void()> task);
+
+    /// \returns the number of asynchronous calls that may execute concurrently
+    virtual size_t get_max_async_calls() const { return 1; }
+
 private:
+    struct AsyncRequest
+    {
+        std::vector<std::shared_ptr<runtime::Tensor>> m_outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> m_inputs;
+        std::promise<bool> m_promise;
+        AsyncCallback m_callback;
+    };
+
+    void schedule_async_calls();
+    void run_async_call(AsyncRequest& request);
+    void async_worker_loop();
+
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+
+    // Per-executable submission queue
+    std::mutex m_async_mutex;
+    std::condition_variable m_async_cv;
+    std::deque<std::shared_ptr<AsyncRequest>> m_async_queue;
+    size_t m_async_in_flight = 0;
+
+    // Worker used by the default dispatch_async
+    std::thread m_async_worker;
+    std::condition_variable m_async_worker_cv;
+    std::deque<std::function<void()>> m_async_tasks;
+    bool m_async_stop = false;
 };
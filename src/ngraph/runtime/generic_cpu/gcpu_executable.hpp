@@ -179,6 +179,7 @@ class ngraph::runtime::gcpu::GCPUExecutable : public Executable
 public:
     GCPUExecutable(const std::shared_ptr<Function>& function,
                    bool enable_performance_collection = false);
+    ~GCPUExecutable() override { wait_for_async_calls(); }
 
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
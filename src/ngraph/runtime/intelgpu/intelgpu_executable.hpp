@@ -41,6 +41,7 @@ public:
                        double compilation_time,
                        double consumed_memory,
                        size_t profile_lines_limit_count);
+    ~IntelGPUExecutable() override { wait_for_async_calls(); }
 
     bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
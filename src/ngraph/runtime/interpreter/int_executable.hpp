@@ -193,6 +193,7 @@ class ngraph::runtime::interpreter::INTExecutable : public Executable
 public:
     INTExecutable(const std::shared_ptr<Function>& function,
                   bool enable_performance_collection = false);
+    ~INTExecutable() override { wait_for_async_calls(); }
 
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
@@ -53,6 +53,7 @@ class ngraph::runtime::nop::NOPExecutable : public Executable
 {
 public:
     NOPExecutable(std::shared_ptr<Function> function, bool enable_performance_collection = false);
+    ~NOPExecutable() override { wait_for_async_calls(); }
     bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 };
@@ -45,7 +45,7 @@ class ngraph::runtime::plaidml::PlaidML_Executable final : public Executable
 {
 public:
     PlaidML_Executable(Build build, std::shared_ptr<Function> func);
-    virtual ~PlaidML_Executable() {}
+    virtual ~PlaidML_Executable() { wait_for_async_calls(); }
     bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) final;
 
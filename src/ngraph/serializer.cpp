@@ -228,6 +228,7 @@ public:
     json serialize_output_vector(const OutputVector& output_vector);
     json serialize_node_reference(const Node& node);
     json serialize_node(const Node& node);
+    json serialize_node_attributes(const Node& node);
     json serialize_axis_set(const AxisSet& axis_set);
 
 protected:
@@ -456,6 +457,16 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    if (get_typeid(node.description()) == OP_TYPEID::UnknownOp)
+    {
+        return "";
+    }
+    JSONSerializer serializer;
+    return serializer.serialize_node_attributes(node).dump();
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
@@ -2023,6 +2034,31 @@ json JSONSerializer::serialize_output_vector(const OutputVector& output_vector)
     return result;
 }
 
+json JSONSerializer::serialize_node_attributes(const Node& n)
+{
+    // Treat the arguments as already serialized so that only n itself is written
+    for (auto& input : n.inputs())
+    {
+        m_nodes_serialized.insert(input.get_source_output().get_node());
+    }
+    for (auto& cdep : n.get_control_dependencies())
+    {
+        m_nodes_serialized.insert(cdep.get());
+    }
+    json node = serialize_node(n);
+    for (auto key : {"name",
+                     "friendly_name",
+                     "inputs",
+                     "control_deps",
+                     "outputs",
+                     "output_shapes",
+                     "provenance_tags"})
+    {
+        node.erase(key);
+    }
+    return node;
+}
+
 json JSONSerializer::serialize_node(const Node& n)
 {
     m_nodes_serialized.insert(&n);
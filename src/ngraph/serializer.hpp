@@ -48,6 +48,15 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize the attributes of a single node to a json string
+    ///
+    /// The name, arguments, outputs, control dependencies, output shapes and provenance tags
+    /// are left out, so two nodes of the same op with equal strings compute the same function
+    /// of their arguments.
+    /// \param node The node to serialize
+    /// \returns The json string, or an empty string if the serializer does not know the op
+    std::string serialize_node_attributes(const Node& node);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
@@ -43,6 +43,11 @@ std::shared_ptr<ngraph::Function> ngraph::deserialize(const std::string& str)
     throw std::runtime_error("serializer disabled in build");
 }
 
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    return "";
+}
+
 void ngraph::set_serialize_output_shapes(bool enable)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -0,0 +1,197 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ngraph
+{
+    /// \brief A sequence whose elements never move once constructed.
+    ///
+    /// The first N elements live inside the object itself, so a node with a few inputs and
+    /// outputs needs no allocation for them. Further elements go to a deque that is only
+    /// created when needed. Like std::deque, emplace_back never invalidates references, which
+    /// descriptor::Input and descriptor::Output rely on since they point at each other.
+    template <typename T, size_t N>
+    class StableVector
+    {
+    public:
+        template <typename Container, typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator(Container* container, size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+            // Allows conversion from iterator to const_iterator
+            template <typename C, typename V>
+            Iterator(const Iterator<C, V>& other)
+                : m_container(other.m_container)
+                , m_index(other.m_index)
+            {
+            }
+
+            reference operator*() const { return (*m_container)[m_index]; }
+            pointer operator->() const { return &(*m_container)[m_index]; }
+            reference operator[](difference_type n) const { return (*m_container)[m_index + n]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int) { return Iterator(m_container, m_index++); }
+            Iterator& operator--()
+            {
+                --m_index;
+                return *this;
+            }
+            Iterator operator--(int) { return Iterator(m_container, m_index--); }
+            Iterator& operator+=(difference_type n)
+            {
+                m_index += n;
+                return *this;
+            }
+            Iterator& operator-=(difference_type n)
+            {
+                m_index -= n;
+                return *this;
+            }
+            Iterator operator+(difference_type n) const
+            {
+                return Iterator(m_container, m_index + n);
+            }
+            Iterator operator-(difference_type n) const
+            {
+                return Iterator(m_container, m_index - n);
+            }
+            difference_type operator-(const Iterator& other) const
+            {
+                return static_cast<difference_type>(m_index) -
+                       static_cast<difference_type>(other.m_index);
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+            bool operator>(const Iterator& other) const { return m_index > other.m_index; }
+            bool operator<=(const Iterator& other) const { return m_index <= other.m_index; }
+            bool operator>=(const Iterator& other) const { return m_index >= other.m_index; }
+        private:
+            template <typename C, typename V>
+            friend class Iterator;
+
+            Container* m_container;
+            size_t m_index;
+        };
+
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<StableVector, T>;
+        using const_iterator = Iterator<const StableVector, const T>;
+
+        StableVector() = default;
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+        ~StableVector() { clear(); }
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_inline_size < N)
+            {
+                T* element = new (inline_data() + m_inline_size) T(std::forward<Args>(args)...);
+                ++m_inline_size;
+                return *element;
+            }
+            if (!m_overflow)
+            {
+                m_overflow.reset(new std::deque<T>());
+            }
+            m_overflow->emplace_back(std::forward<Args>(args)...);
+            return m_overflow->back();
+        }
+
+        /// \brief Destroys all elements, last first.
+        void clear()
+        {
+            m_overflow.reset();
+            while (m_inline_size > 0)
+            {
+                inline_data()[--m_inline_size].~T();
+            }
+        }
+
+        size_t size() const { return m_inline_size + (m_overflow ? m_overflow->size() : 0); }
+        bool empty() const { return size() == 0; }
+        T& operator[](size_t i)
+        {
+            return i < N ? inline_data()[i] : (*m_overflow)[i - N];
+        }
+        const T& operator[](size_t i) const
+        {
+            return i < N ? inline_data()[i] : (*m_overflow)[i - N];
+        }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        T& front() { return (*this)[0]; }
+        const T& front() const { return (*this)[0]; }
+        T& back() { return (*this)[size() - 1]; }
+        const T& back() const { return (*this)[size() - 1]; }
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, size()); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size()); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+    private:
+        void check_index(size_t i) const
+        {
+            if (i >= size())
+            {
+                throw std::out_of_range("StableVector index out of range");
+            }
+        }
+        T* inline_data() { return reinterpret_cast<T*>(&m_inline_storage); }
+        const T* inline_data() const { return reinterpret_cast<const T*>(&m_inline_storage); }
+
+        typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type m_inline_storage;
+        size_t m_inline_size{0};
+        std::unique_ptr<std::deque<T>> m_overflow;
+    };
+}
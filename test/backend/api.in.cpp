@@ -162,3 +162,43 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    const size_t request_count = 8;
+    vector<shared_ptr<runtime::Tensor>> args;
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> futures;
+    atomic<size_t> callback_count{0};
+    for (size_t i = 0; i < request_count; i++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(4, static_cast<float>(i)));
+        auto result = backend->create_tensor(element::f32, shape);
+        args.push_back(a);
+        results.push_back(result);
+        futures.push_back(handle->call_async(
+            {result}, {a, a}, [&callback_count](bool rc, exception_ptr error) {
+                EXPECT_TRUE(rc);
+                EXPECT_EQ(error, nullptr);
+                callback_count++;
+            }));
+    }
+
+    for (size_t i = 0; i < request_count; i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(results[i]),
+                                      vector<float>(4, 2.0f * i),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+    }
+    EXPECT_EQ(callback_count, request_count);
+}
@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -292,3 +293,71 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_executable_cache)
+{
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto new_shape = make_shared<op::Parameter>(element::i64, PartialShape{2});
+
+    auto x_reshaped = make_shared<op::DynReshape>(x, new_shape);
+
+    auto f = make_shared<Function>(NodeVector{x_reshaped}, ParameterVector{x, new_shape});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+
+    auto dyn_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    if (dyn_ex == nullptr)
+    {
+        // Backend supports dynamic shapes natively; no wrapper cache to test.
+        return;
+    }
+    dyn_ex->set_cache_capacity(2);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic(2));
+
+    auto run = [&](const Shape& shape, const vector<int64_t>& target_shape) {
+        vector<float> inputs(shape_size(shape));
+        for (size_t i = 0; i < shape_size(shape); i++)
+        {
+            inputs[i] = i;
+        }
+        auto t_x = backend->create_tensor(element::f32, shape);
+        auto t_shape = backend->create_tensor(element::i64, Shape{2});
+        copy_data(t_x, inputs);
+        copy_data(t_shape, target_shape);
+
+        ex->call_with_validate({t_r}, {t_x, t_shape});
+
+        ASSERT_EQ(t_r->get_shape(), (Shape{static_cast<size_t>(target_shape[0]),
+                                           static_cast<size_t>(target_shape[1])}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), inputs));
+    };
+
+    run(Shape{2, 6}, {3, 4});
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 1);
+    EXPECT_EQ(dyn_ex->get_cache_hits(), 0);
+
+    // Same input shape and same shape-relevant values: served from the cache.
+    run(Shape{2, 6}, {3, 4});
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 1);
+    EXPECT_EQ(dyn_ex->get_cache_hits(), 1);
+
+    // Same input shape but different shape-relevant values: must recompile.
+    run(Shape{2, 6}, {6, 2});
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 2);
+    EXPECT_EQ(dyn_ex->get_cache_size(), 2);
+
+    // Different input shape: recompile, evicting the least recently used entry ({3, 4}).
+    run(Shape{4, 2}, {2, 4});
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 3);
+    EXPECT_EQ(dyn_ex->get_cache_size(), 2);
+
+    run(Shape{2, 6}, {6, 2});
+    EXPECT_EQ(dyn_ex->get_cache_hits(), 2);
+
+    run(Shape{2, 6}, {3, 4});
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 4);
+
+    dyn_ex->clear_cache();
+    EXPECT_EQ(dyn_ex->get_cache_size(), 0);
+}
@@ -809,3 +809,45 @@ NGRAPH_TEST(${BACKEND_NAME}, gather_no_axis_bool)
                                 read_vector<char>(result),
                                 static_cast<char> MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, gather_many_indices_axis_1)
+{
+    Shape params_shape{3, 1000, 17};
+    Shape indices_shape{64, 8};
+    auto P = make_shared<op::Parameter>(element::f32, params_shape);
+    auto I = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto G = make_shared<op::Gather>(P, I, 1);
+    auto f = make_shared<Function>(G, ParameterVector{P, I});
+
+    vector<float> params(shape_size(params_shape));
+    iota(params.begin(), params.end(), 0.0f);
+    vector<int32_t> indices(shape_size(indices_shape));
+    for (size_t j = 0; j < indices.size(); j++)
+    {
+        indices[j] = static_cast<int32_t>((j * 389) % params_shape[1]);
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto p = backend->create_tensor(element::f32, params_shape);
+    copy_data(p, params);
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, indices);
+    auto result = backend->create_tensor(element::f32, Shape{3, 64, 8, 17});
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {p, i});
+
+    vector<float> expected;
+    for (size_t outer = 0; outer < params_shape[0]; outer++)
+    {
+        for (auto index : indices)
+        {
+            for (size_t inner = 0; inner < params_shape[2]; inner++)
+            {
+                expected.push_back(
+                    params[(outer * params_shape[1] + index) * params_shape[2] + inner]);
+            }
+        }
+    }
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
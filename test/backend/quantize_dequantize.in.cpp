@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close.hpp"
@@ -969,6 +971,188 @@ NGRAPH_TEST(${BACKEND_NAME}, quantize_ROUND_DOWN)
               read_vector<output_c_type>(y));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, quantize_ROUND_NEAREST_TOWARD_EVEN_innermost_axis)
+{
+    Shape input_shape{100, 3};
+    Shape scale_offset_shape{3};
+    AxisSet quantization_axes{1};
+
+    auto input_type = element::f32;
+    auto output_type = element::i8;
+
+    typedef float input_c_type;
+    typedef int8_t output_c_type;
+
+    op::Quantize::RoundMode round_mode = op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+
+    vector<input_c_type> scales{1, 2, 4};
+    vector<output_c_type> offsets{0, 1, -1};
+    auto X = make_shared<op::Parameter>(input_type, input_shape);
+    auto scale = op::Constant::create(input_type, scale_offset_shape, scales);
+    auto offset = op::Constant::create(output_type, scale_offset_shape, offsets);
+    auto quantize =
+        make_shared<op::Quantize>(X, scale, offset, output_type, quantization_axes, round_mode);
+    auto f = make_shared<Function>(quantize, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(input_type, input_shape);
+    auto y = backend->create_tensor(output_type, input_shape);
+
+    // Divided by its scale every element is a multiple of one half, so there are plenty of ties
+    vector<input_c_type> input(shape_size(input_shape));
+    vector<output_c_type> expected(input.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        int half_steps = static_cast<int>(i / 3 % 41) - 20;
+        input[i] = half_steps * scales[i % 3] / 2;
+        expected[i] = static_cast<output_c_type>(
+            std::nearbyint(static_cast<float>(half_steps) / 2) + offsets[i % 3]);
+    }
+    copy_data(x, input);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_EQ(expected, read_vector<output_c_type>(y));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dequantize_innermost_axis)
+{
+    Shape input_shape{100, 3};
+    Shape scale_offset_shape{3};
+    AxisSet quantization_axes{1};
+
+    auto input_type = element::i8;
+    auto output_type = element::f32;
+
+    typedef int8_t input_c_type;
+    typedef float output_c_type;
+
+    vector<output_c_type> scales{1, 2, 4};
+    vector<input_c_type> offsets{1, 0, -1};
+    auto X = make_shared<op::Parameter>(input_type, input_shape);
+    auto scale = op::Constant::create(output_type, scale_offset_shape, scales);
+    auto offset = op::Constant::create(input_type, scale_offset_shape, offsets);
+    auto dequantize = make_shared<op::Dequantize>(X, scale, offset, output_type, quantization_axes);
+    auto f = make_shared<Function>(dequantize, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(input_type, input_shape);
+    auto y = backend->create_tensor(output_type, input_shape);
+
+    vector<input_c_type> input(shape_size(input_shape));
+    vector<output_c_type> expected(input.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<input_c_type>(static_cast<int>(i / 3 % 41) - 20);
+        expected[i] = (input[i] - offsets[i % 3]) * scales[i % 3];
+    }
+    copy_data(x, input);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_TRUE(
+        test::all_close_f(expected, read_vector<output_c_type>(y), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dequantize_innermost_axis_zero_first_offset)
+{
+    Shape input_shape{50, 3};
+    Shape scale_offset_shape{3};
+    AxisSet quantization_axes{1};
+
+    auto input_type = element::u8;
+    auto output_type = element::f32;
+
+    typedef uint8_t input_c_type;
+    typedef float output_c_type;
+
+    // Only the first offset is zero
+    vector<output_c_type> scales{2, 1, 0.5};
+    vector<input_c_type> offsets{0, 2, 7};
+    auto X = make_shared<op::Parameter>(input_type, input_shape);
+    auto scale = op::Constant::create(output_type, scale_offset_shape, scales);
+    auto offset = op::Constant::create(input_type, scale_offset_shape, offsets);
+    auto dequantize = make_shared<op::Dequantize>(X, scale, offset, output_type, quantization_axes);
+    auto f = make_shared<Function>(dequantize, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(input_type, input_shape);
+    auto y = backend->create_tensor(output_type, input_shape);
+
+    vector<input_c_type> input(shape_size(input_shape));
+    vector<output_c_type> expected(input.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<input_c_type>(i % 23);
+        expected[i] = (static_cast<int>(input[i]) - offsets[i % 3]) * scales[i % 3];
+    }
+    copy_data(x, input);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_TRUE(
+        test::all_close_f(expected, read_vector<output_c_type>(y), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_dequantize_channels_last)
+{
+    // Every element of the trailing {4, 3} block has its own scale and offset
+    Shape input_shape{5, 4, 3};
+    Shape scale_offset_shape{4, 3};
+    AxisSet quantization_axes{1, 2};
+
+    auto real_type = element::f32;
+    auto quant_type = element::u8;
+
+    typedef float real_c_type;
+    typedef uint8_t quant_c_type;
+
+    op::Quantize::RoundMode round_mode = op::Quantize::RoundMode::ROUND_NEAREST_UPWARD;
+
+    vector<real_c_type> scales(shape_size(scale_offset_shape));
+    vector<quant_c_type> offsets(scales.size());
+    for (size_t i = 0; i < scales.size(); i++)
+    {
+        scales[i] = static_cast<real_c_type>(i % 4 + 1);
+        offsets[i] = static_cast<quant_c_type>(10 * (i + 1));
+    }
+
+    auto X = make_shared<op::Parameter>(real_type, input_shape);
+    auto scale = op::Constant::create(real_type, scale_offset_shape, scales);
+    auto offset = op::Constant::create(quant_type, scale_offset_shape, offsets);
+    auto quantize =
+        make_shared<op::Quantize>(X, scale, offset, quant_type, quantization_axes, round_mode);
+    auto dequantize =
+        make_shared<op::Dequantize>(quantize, scale, offset, real_type, quantization_axes);
+    auto f = make_shared<Function>(NodeVector{quantize, dequantize}, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(real_type, input_shape);
+    auto q = backend->create_tensor(quant_type, input_shape);
+    auto y = backend->create_tensor(real_type, input_shape);
+
+    // Quantized values stay in [0, 255] for the largest offset of 120
+    vector<real_c_type> input(shape_size(input_shape));
+    vector<quant_c_type> expected_q(input.size());
+    vector<real_c_type> expected_y(input.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        size_t c = i % scales.size();
+        int half_steps = static_cast<int>(i % 11) - 5;
+        input[i] = half_steps * scales[c] / 2;
+        int rounded = static_cast<int>(std::floor(half_steps / 2.0 + 0.5));
+        expected_q[i] = static_cast<quant_c_type>(rounded + offsets[c]);
+        expected_y[i] = rounded * scales[c];
+    }
+    copy_data(x, input);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({q, y}, {x});
+    EXPECT_EQ(expected_q, read_vector<quant_c_type>(q));
+    EXPECT_TRUE(
+        test::all_close_f(expected_y, read_vector<real_c_type>(y), MIN_FLOAT_TOLERANCE_BITS));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, dequantize_dynamic_offset)
 {
     Shape input_shape{4};
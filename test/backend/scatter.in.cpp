@@ -284,3 +284,161 @@ NGRAPH_TEST(${BACKEND_NAME}, scatter_nd_add_2d_to_3d)
                                   read_vector<float>(result),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_add_many_duplicate_indices)
+{
+    Shape ref_shape{5, 300};
+    Shape indices_shape{64};
+    Shape updates_shape{64, 300};
+    auto R = make_shared<op::Parameter>(element::f32, ref_shape);
+    auto I = make_shared<op::Parameter>(element::i64, indices_shape);
+    auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+    auto G = make_shared<op::ScatterAdd>(R, I, U);
+    auto f =
+        make_shared<Function>(make_shared<op::GetOutputElement>(G, 0), ParameterVector{R, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Most updates hit the same two rows, row 4 is never updated
+    vector<float> ref_data(shape_size(ref_shape));
+    vector<int64_t> indices_data(shape_size(indices_shape));
+    vector<float> updates_data(shape_size(updates_shape));
+    for (size_t j = 0; j < ref_data.size(); j++)
+    {
+        ref_data[j] = static_cast<float>(j % 7);
+    }
+    for (size_t i = 0; i < indices_data.size(); i++)
+    {
+        indices_data[i] = (i % 16 == 0) ? i / 16 : i % 2;
+    }
+    for (size_t j = 0; j < updates_data.size(); j++)
+    {
+        updates_data[j] = static_cast<float>(j % 5);
+    }
+    vector<float> expected(ref_data);
+    for (size_t i = 0; i < indices_data.size(); i++)
+    {
+        for (size_t j = 0; j < ref_shape[1]; j++)
+        {
+            expected[indices_data[i] * ref_shape[1] + j] += updates_data[i * ref_shape[1] + j];
+        }
+    }
+
+    auto r = backend->create_tensor(element::f32, ref_shape);
+    copy_data(r, ref_data);
+    auto i = backend->create_tensor(element::i64, indices_shape);
+    copy_data(i, indices_data);
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, updates_data);
+    auto result = backend->create_tensor(element::f32, ref_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {r, i, u});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_add_two_hot_long_rows)
+{
+    // Only two long rows are updated, so with more threads than hot rows each row is split into
+    // column ranges; the row length is not a multiple of the block count
+    Shape ref_shape{6, 1030};
+    Shape indices_shape{24};
+    Shape updates_shape{24, 1030};
+    auto R = make_shared<op::Parameter>(element::f32, ref_shape);
+    auto I = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+    auto G = make_shared<op::ScatterAdd>(R, I, U);
+    auto f =
+        make_shared<Function>(make_shared<op::GetOutputElement>(G, 0), ParameterVector{R, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> ref_data(shape_size(ref_shape));
+    vector<int32_t> indices_data(shape_size(indices_shape));
+    vector<float> updates_data(shape_size(updates_shape));
+    for (size_t j = 0; j < ref_data.size(); j++)
+    {
+        ref_data[j] = static_cast<float>(j % 13);
+    }
+    for (size_t i = 0; i < indices_data.size(); i++)
+    {
+        indices_data[i] = (i % 3 == 0) ? 4 : 1;
+    }
+    for (size_t j = 0; j < updates_data.size(); j++)
+    {
+        updates_data[j] = static_cast<float>(j % 9);
+    }
+    vector<float> expected(ref_data);
+    for (size_t i = 0; i < indices_data.size(); i++)
+    {
+        for (size_t j = 0; j < ref_shape[1]; j++)
+        {
+            expected[indices_data[i] * ref_shape[1] + j] += updates_data[i * ref_shape[1] + j];
+        }
+    }
+
+    auto r = backend->create_tensor(element::f32, ref_shape);
+    copy_data(r, ref_data);
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, indices_data);
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, updates_data);
+    auto result = backend->create_tensor(element::f32, ref_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {r, i, u});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_nd_add_many_duplicate_indices)
+{
+    Shape ref_shape{4, 3, 50};
+    Shape indices_shape{40, 2};
+    Shape updates_shape{40, 50};
+    auto R = make_shared<op::Parameter>(element::f32, ref_shape);
+    auto I = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+    auto G = make_shared<op::ScatterNDAdd>(R, I, U);
+    auto f =
+        make_shared<Function>(make_shared<op::GetOutputElement>(G, 0), ParameterVector{R, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> ref_data(shape_size(ref_shape));
+    vector<int32_t> indices_data(shape_size(indices_shape));
+    vector<float> updates_data(shape_size(updates_shape));
+    for (size_t j = 0; j < ref_data.size(); j++)
+    {
+        ref_data[j] = static_cast<float>(j % 11);
+    }
+    for (size_t i = 0; i < indices_shape[0]; i++)
+    {
+        indices_data[2 * i] = (i * 7) % 3;
+        indices_data[2 * i + 1] = (i * 5) % 2;
+    }
+    for (size_t j = 0; j < updates_data.size(); j++)
+    {
+        updates_data[j] = static_cast<float>(j % 3);
+    }
+    vector<float> expected(ref_data);
+    for (size_t i = 0; i < indices_shape[0]; i++)
+    {
+        size_t row = indices_data[2 * i] * ref_shape[1] + indices_data[2 * i + 1];
+        for (size_t j = 0; j < ref_shape[2]; j++)
+        {
+            expected[row * ref_shape[2] + j] += updates_data[i * ref_shape[2] + j];
+        }
+    }
+
+    auto r = backend->create_tensor(element::f32, ref_shape);
+    copy_data(r, ref_data);
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, indices_data);
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, updates_data);
+    auto result = backend->create_tensor(element::f32, ref_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {r, i, u});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -265,3 +265,40 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_overflow)
                            expf(5) / d2};
     EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, softmax_axes_0_2_of_4d)
+{
+    // Reduced axes that are not adjacent, with a large kept innermost axis
+    Shape shape{2, 3, 4, 300};
+    AxisSet axes{0, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Softmax>(A, axes), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> input(shape_size(shape));
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<float>(i % 17) - 8;
+    }
+    // Every output element divides by the sum over the 8 elements of its (axis 1, axis 3) row
+    vector<float> expected(input.size());
+    vector<float> sums(shape[1] * shape[3], 0);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        sums[(i / (shape[2] * shape[3])) % shape[1] * shape[3] + i % shape[3]] += expf(input[i]);
+    }
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        expected[i] =
+            expf(input[i]) / sums[(i / (shape[2] * shape[3])) % shape[1] * shape[3] + i % shape[3]];
+    }
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, input);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
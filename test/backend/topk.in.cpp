@@ -730,6 +730,47 @@ NGRAPH_TEST(${BACKEND_NAME}, topk_3d_large_input_min)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, topk_2d_large_innermost_with_equal_values)
+{
+    Shape shape{16, 4099};
+    for (bool compute_max : {true, false})
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::TopK>(A, 1, element::i64, 7, compute_max);
+
+        auto interp_f_0 =
+            make_shared<Function>(make_shared<op::GetOutputElement>(B, 0), ParameterVector{A});
+        auto interp_f_1 =
+            make_shared<Function>(make_shared<op::GetOutputElement>(B, 1), ParameterVector{A});
+        auto backend_f_0 = ngraph::clone_function(*interp_f_0);
+        auto backend_f_1 = ngraph::clone_function(*interp_f_1);
+
+        // Few distinct values, so the selection has to break ties by index
+        default_random_engine engine(0);
+        uniform_int_distribution<int> distribution(0, 50);
+        vector<float> tensor_val(shape_size(shape));
+        for (auto& value : tensor_val)
+        {
+            value = static_cast<float>(distribution(engine));
+        }
+        vector<vector<float>> args{tensor_val};
+
+        auto interp_results_0 = execute<float, int64_t>(interp_f_0, args, "INTERPRETER");
+        auto backend_results_0 = execute<float, int64_t>(backend_f_0, args, "${BACKEND_NAME}");
+        for (size_t i = 0; i < backend_results_0.size(); i++)
+        {
+            EXPECT_EQ(backend_results_0.at(i), interp_results_0.at(i));
+        }
+
+        auto interp_results_1 = execute(interp_f_1, args, "INTERPRETER");
+        auto backend_results_1 = execute(backend_f_1, args, "${BACKEND_NAME}");
+        for (size_t i = 0; i < backend_results_1.size(); i++)
+        {
+            EXPECT_EQ(backend_results_1.at(i), interp_results_1.at(i));
+        }
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, topk_3d_single_output)
 {
     Shape shape{2, 3, 2};
@@ -26,8 +26,10 @@ static string s_manifest = "${MANIFEST}";
 class UnhandledOp : public ngraph::op::Op
 {
 public:
+    static const std::string type_name;
+
     UnhandledOp(const std::shared_ptr<Node>& arg)
-        : Op("Unsupported_op", check_single_output_args({arg}))
+        : Op(type_name, check_single_output_args({arg}))
     {
         constructor_validate_and_infer_types();
     }
@@ -43,6 +45,8 @@ protected:
     }
 };
 
+const std::string UnhandledOp::type_name("Unsupported_op");
+
 NGRAPH_TEST(${BACKEND_NAME}, unhandled_op)
 {
     Shape shape{2, 2};
@@ -47,6 +47,8 @@ using namespace std;
 class ControlDependencyOp : public ngraph::op::Op
 {
 public:
+    static const std::string type_name;
+
     virtual std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override
     {
         auto clone = make_shared<ControlDependencyOp>(new_args, std::set<std::shared_ptr<Node>>{});
@@ -54,7 +56,7 @@ public:
     }
 
     ControlDependencyOp(const NodeVector& args, const std::set<std::shared_ptr<Node>>& deps)
-        : Op("ControlDependencyOp", args)
+        : Op(type_name, args)
     {
         if (args.size() == 0 && deps.size() == 0)
         {
@@ -78,6 +80,8 @@ public:
     }
 };
 
+const std::string ControlDependencyOp::type_name("ControlDependencyOp");
+
 TEST(control_dependencies, cdep_ops)
 {
     auto A = make_shared<op::Parameter>(element::f32, Shape{});
@@ -85,6 +89,8 @@ TEST(control_dependencies, cdep_ops)
     auto absn = make_shared<op::Abs>(A);
     auto cdop =
         make_shared<ControlDependencyOp>(NodeVector{A}, std::set<std::shared_ptr<Node>>{absn});
+    // The node refers to the type name of its class rather than holding a copy
+    EXPECT_EQ(&cdop->description(), &ControlDependencyOp::type_name);
 
     auto f = make_shared<Function>(cdop, ParameterVector{A, B});
     test_ordered_ops(f, NodeVector{absn});
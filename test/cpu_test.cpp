@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <memory>
@@ -39,6 +40,8 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -1051,6 +1054,202 @@ TEST(cpu_test, thread_safe_calls_convolution_2d_2items)
     unset_environment("NGRAPH_CPU_CONCURRENCY");
 }
 
+TEST(cpu_test, thread_safe_calls_cacheable_inputs)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    Shape shape{2, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape, true);
+    auto B = make_shared<op::Parameter>(element::f32, shape, true);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Relu>(A + B) * C, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+
+    // Every thread binds its own cacheable inputs and marks them as not stale after the first
+    // call. Contexts are shared between threads, so a context must notice that the inputs it
+    // cached came from a different thread.
+    auto make_calls = [&](float base) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto c = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), base));
+        copy_data(b, vector<float>(shape_size(shape), 1.0f));
+        copy_data(c, vector<float>(shape_size(shape), 2.0f));
+        vector<float> expected(shape_size(shape), (base + 1.0f) * 2.0f);
+
+        for (size_t i = 0; i < 20; i++)
+        {
+            handle->call_with_validate({result}, {a, b, c});
+            EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result), tolerance));
+            a->set_stale(false);
+            b->set_stale(false);
+        }
+    };
+
+    std::thread call1(make_calls, 1.0f);
+    std::thread call2(make_calls, 2.0f);
+    std::thread call3(make_calls, 3.0f);
+    std::thread call4(make_calls, 4.0f);
+    call1.join();
+    call2.join();
+    call3.join();
+    call4.join();
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, stale_inputs_gate_cached_ops)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape, true);
+    auto B = make_shared<op::Parameter>(element::f32, shape, true);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto check = [&](float expected) {
+        handle->call_with_validate({result}, {a, b, c});
+        EXPECT_EQ(vector<float>(shape_size(shape), expected), read_vector<float>(result));
+    };
+    copy_data(a, vector<float>(shape_size(shape), 1));
+    copy_data(b, vector<float>(shape_size(shape), 1));
+    copy_data(c, vector<float>(shape_size(shape), 2));
+    check(4);
+    a->set_stale(false);
+    b->set_stale(false);
+    // Later calls replay the execution plan
+    check(4);
+
+    // A changed without being marked stale, so the cached A + B is reused
+    copy_data(a, vector<float>(shape_size(shape), 5));
+    check(4);
+    // C is not cacheable, the Multiply reruns on the cached sum
+    copy_data(c, vector<float>(shape_size(shape), 3));
+    check(6);
+    // A stale A reruns the Add
+    a->set_stale(true);
+    check(18);
+    a->set_stale(false);
+    check(18);
+    copy_data(b, vector<float>(shape_size(shape), -10));
+    check(18);
+    b->set_stale(true);
+    check(-15);
+    b->set_stale(false);
+    copy_data(b, vector<float>(shape_size(shape), 1));
+    check(-15);
+}
+
+TEST(cpu_test, executable_thread_config)
+{
+    auto run = []() {
+        Shape shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::Add>(A, B) * B, ParameterVector{A, B});
+
+        auto backend = runtime::Backend::create("CPU");
+        string error;
+        EXPECT_FALSE(backend->set_config({{"intra_op_parallelism", "0"}}, error));
+        EXPECT_FALSE(backend->set_config({{"unknown_key", "1"}}, error));
+        ASSERT_TRUE(backend->set_config(
+            {{"intra_op_parallelism", "1"}, {"inter_op_parallelism", "2"}, {"cpu_affinity", "0"}},
+            error))
+            << error;
+
+        auto handle = backend->compile(f);
+        auto cpu_executable = static_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+        auto& executor = cpu_executable->get_cpu_executor();
+        ASSERT_NE(executor, nullptr);
+        EXPECT_NE(executor.get(), &runtime::cpu::executor::GetCPUExecutor());
+        EXPECT_EQ(executor->get_num_thread_pools(), 2);
+        EXPECT_EQ(executor->get_num_threads_per_pool(), 1);
+
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+        for (int i = 0; i < 3; i++)
+        {
+            handle->call_with_validate({result}, {a, b});
+            EXPECT_EQ((vector<float>{30, 48, 70, 96}), read_vector<float>(result));
+        }
+    };
+    run();
+
+#ifdef NGRAPH_TBB_ENABLE
+    // Flow graph nodes run on TBB worker threads, which must still use the executable's
+    // executor
+    bool use_tbb = (getenv("NGRAPH_CPU_USE_TBB") != nullptr);
+    if (!use_tbb)
+    {
+        set_environment("NGRAPH_CPU_USE_TBB", "1", 1);
+    }
+    run();
+    if (!use_tbb)
+    {
+        unset_environment("NGRAPH_CPU_USE_TBB");
+    }
+#endif
+}
+
+TEST(cpu_test, bound_call)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+
+    vector<float> a{1, 2, 3, 4};
+    vector<float> b{5, 6, 7, 8};
+    vector<float> result(4);
+    EXPECT_THROW(handle->call_bound(), ngraph_error);
+    EXPECT_THROW(handle->bind({result.data()}, {a.data()}), ngraph_error);
+    handle->bind({result.data()}, {a.data(), b.data()});
+
+    handle->call_bound();
+    EXPECT_EQ((vector<float>{30, 48, 70, 96}), result);
+
+    // Inputs are re-read on every call
+    b = {1, 1, 1, 1};
+    handle->call_bound();
+    EXPECT_EQ((vector<float>{2, 3, 4, 5}), result);
+
+    // Regular calls still work after bound calls
+    auto t_a = backend->create_tensor(element::f32, shape, a.data());
+    auto t_b = backend->create_tensor(element::f32, shape, b.data());
+    auto t_result = backend->create_tensor(element::f32, shape);
+    handle->call_with_validate({t_result}, {t_a, t_b});
+    EXPECT_EQ((vector<float>{2, 3, 4, 5}), read_vector<float>(t_result));
+}
+
 TEST(cpu_test, constant_reshape)
 {
     Shape shape_in{2, 4};
@@ -2149,3 +2348,254 @@ TEST(cpu_test, tensor_copy_from_different_layout)
 
     EXPECT_EQ((vector<uint8_t>{1, 4, 2, 5, 3, 6}), read_vector<uint8_t>(b));
 }
+
+TEST(cpu_test, inter_op_scheduler)
+{
+    // Diamond with a tail: 0 -> {1, 2} -> 3 -> 4
+    vector<vector<size_t>> successors{{1, 2}, {3}, {3}, {4}, {}};
+    vector<size_t> predecessor_counts{0, 1, 1, 2, 1};
+
+    runtime::cpu::InterOpScheduler scheduler(4);
+    EXPECT_EQ(scheduler.get_num_threads(), 4);
+    for (size_t iteration = 0; iteration < 100; iteration++)
+    {
+        atomic<size_t> counter{0};
+        vector<size_t> order(successors.size());
+        vector<size_t> workers(successors.size());
+        scheduler.run(successors, predecessor_counts, [&](size_t index, size_t worker) {
+            order[index] = counter++;
+            workers[index] = worker;
+        });
+        EXPECT_EQ(counter, successors.size());
+        EXPECT_LT(order[0], order[1]);
+        EXPECT_LT(order[0], order[2]);
+        EXPECT_LT(order[1], order[3]);
+        EXPECT_LT(order[2], order[3]);
+        EXPECT_LT(order[3], order[4]);
+        for (auto worker : workers)
+        {
+            EXPECT_LT(worker, scheduler.get_num_threads());
+        }
+    }
+
+    // The first failure is rethrown and dependents of the failed task are skipped
+    atomic<size_t> executed{0};
+    EXPECT_THROW(scheduler.run(successors,
+                               predecessor_counts,
+                               [&](size_t index, size_t) {
+                                   executed++;
+                                   if (index == 3)
+                                   {
+                                       throw ngraph_error("task failed");
+                                   }
+                               }),
+                 ngraph_error);
+    EXPECT_EQ(executed, 4);
+}
+
+TEST(cpu_test, inter_op_parallelism_matches_interpreter)
+{
+    // Independent branches whose temporaries share reused pool space, with in-place Relus
+    auto make_function = []() {
+        Shape shape{16, 16};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto branch1 = make_shared<op::Relu>(A + B) * A;
+        auto branch2 = make_shared<op::Relu>(A - B) * B;
+        auto branch3 = make_shared<op::Tanh>(A * B) + A;
+        auto branch4 = make_shared<op::Relu>(B - A) + make_shared<op::Negative>(B);
+        return make_shared<Function>(
+            NodeVector{(branch1 + branch2) * branch3, branch3 - branch4, branch1 * branch4},
+            ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    string error;
+    ASSERT_TRUE(backend->set_config({{"intra_op_parallelism", "1"}, {"inter_op_parallelism", "4"}},
+                                    error))
+        << error;
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    auto handle = backend->compile(make_function(), pass_config);
+    auto cpu_executable = static_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    ASSERT_NE(cpu_executable->get_cpu_executor(), nullptr);
+    ASSERT_NE(cpu_executable->get_cpu_executor()->get_inter_op_scheduler(), nullptr);
+
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    auto int_handle = int_backend->compile(make_function());
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(16 * 16), b(16 * 16);
+    // The first call runs sequentially, later calls go through the inter-op scheduler
+    for (int i = 0; i < 10; i++)
+    {
+        rng.initialize(a);
+        rng.initialize(b);
+        vector<shared_ptr<runtime::Tensor>> args, int_args, results, int_results;
+        for (auto& data : {a, b})
+        {
+            args.push_back(backend->create_tensor(element::f32, Shape{16, 16}));
+            copy_data(args.back(), data);
+            int_args.push_back(int_backend->create_tensor(element::f32, Shape{16, 16}));
+            copy_data(int_args.back(), data);
+        }
+        for (size_t j = 0; j < 3; j++)
+        {
+            results.push_back(backend->create_tensor(element::f32, Shape{16, 16}));
+            int_results.push_back(int_backend->create_tensor(element::f32, Shape{16, 16}));
+        }
+        handle->call_with_validate(results, args);
+        int_handle->call_with_validate(int_results, int_args);
+        for (size_t j = 0; j < 3; j++)
+        {
+            EXPECT_TRUE(test::all_close_f(read_vector<float>(int_results[j]),
+                                          read_vector<float>(results[j])))
+                << "call " << i << ", output " << j;
+        }
+    }
+}
+
+TEST(cpu_test, parse_cpu_list)
+{
+    using runtime::cpu::executor::ParseCPUList;
+    EXPECT_EQ((vector<int>{}), ParseCPUList(""));
+    EXPECT_EQ((vector<int>{3}), ParseCPUList("3"));
+    EXPECT_EQ((vector<int>{0, 1, 2, 3}), ParseCPUList("0-3"));
+    EXPECT_EQ((vector<int>{0, 1, 2, 3, 8, 10, 11}), ParseCPUList("0-3,8,10-11"));
+    EXPECT_EQ((vector<int>{5}), ParseCPUList("5-5"));
+    for (string bad : {"a", "1,", ",1", "1,,2", "-1", "1-", "3-1", "1-2-3", "0x1", " 1"})
+    {
+        EXPECT_THROW(ParseCPUList(bad), ngraph_error) << bad;
+    }
+}
+
+TEST(cpu_test, numa_nodes)
+{
+    string node_dir = file_util::path_join(file_util::get_temp_directory_path(), "cpu_test_numa");
+    file_util::remove_directory(node_dir);
+    file_util::make_directory(node_dir);
+    // Node 1 has no CPUs, node 3 is never reached since node 2 is missing
+    vector<string> cpulists{"0-1,4", "", "", "6-7"};
+    for (size_t i = 0; i < cpulists.size(); i++)
+    {
+        if (i == 2)
+        {
+            continue;
+        }
+        string path = file_util::path_join(node_dir, "node" + to_string(i));
+        file_util::make_directory(path);
+        ofstream(file_util::path_join(path, "cpulist")) << cpulists[i] << "\n";
+    }
+    auto nodes = runtime::cpu::executor::GetNUMANodes(node_dir);
+    file_util::remove_directory(node_dir);
+    ASSERT_EQ(nodes.size(), 1);
+    EXPECT_EQ(nodes[0].first, 0);
+    EXPECT_EQ((vector<int>{0, 1, 4}), nodes[0].second);
+}
+
+TEST(cpu_test, numa_pool_assignment)
+{
+    using runtime::cpu::executor::AssignNUMANodes;
+    vector<pair<int, vector<int>>> nodes{{0, {0, 1}}, {1, {2, 3}}};
+
+    // A single pool spans every node instead of leaving node 1 idle
+    auto pools = AssignNUMANodes(1, nodes);
+    ASSERT_EQ(pools.size(), 1);
+    EXPECT_EQ(pools[0].first, -1);
+    EXPECT_EQ((vector<int>{0, 1, 2, 3}), pools[0].second);
+
+    pools = AssignNUMANodes(3, nodes);
+    ASSERT_EQ(pools.size(), 3);
+    EXPECT_EQ(pools[0].first, 0);
+    EXPECT_EQ(pools[1].first, 1);
+    EXPECT_EQ(pools[2].first, 0);
+    EXPECT_EQ((vector<int>{2, 3}), pools[1].second);
+    EXPECT_EQ((vector<int>{0, 1}), pools[2].second);
+
+    nodes.push_back({2, {4, 5}});
+    pools = AssignNUMANodes(2, nodes);
+    ASSERT_EQ(pools.size(), 2);
+    EXPECT_EQ(pools[0].first, -1);
+    EXPECT_EQ((vector<int>{0, 1, 4, 5}), pools[0].second);
+    EXPECT_EQ(pools[1].first, 1);
+
+    pools = AssignNUMANodes(2, {});
+    ASSERT_EQ(pools.size(), 2);
+    EXPECT_EQ(pools[0].first, -1);
+    EXPECT_TRUE(pools[0].second.empty());
+}
+
+TEST(cpu_test, bind_memory_without_numa)
+{
+    runtime::cpu::executor::CPUExecutor executor(2, 1, {});
+    EXPECT_FALSE(executor.is_numa_aware());
+    EXPECT_EQ(executor.get_numa_node(1), -1);
+    vector<char> buffer(1 << 16, 1);
+    executor.bind_memory(buffer.data(), buffer.size(), 1);
+    EXPECT_EQ(buffer[0], 1);
+}
+
+TEST(cpu_test, thread_budget)
+{
+    using namespace runtime::cpu::executor;
+    set_environment("NGRAPH_CPU_THREAD_BUDGET", "3", 1);
+    EXPECT_EQ(GetThreadBudget(), 3);
+    set_environment("NGRAPH_CPU_THREAD_BUDGET", "0", 1);
+    EXPECT_THROW(GetThreadBudget(), ngraph_error);
+    set_environment("NGRAPH_CPU_THREAD_BUDGET", "many", 1);
+    EXPECT_THROW(GetThreadBudget(), ngraph_error);
+    unset_environment("NGRAPH_CPU_THREAD_BUDGET");
+    EXPECT_EQ(GetThreadBudget(), max(1, static_cast<int>(thread::hardware_concurrency())));
+
+    // Thread pools and dispatch threads of every executor come out of the one budget, with at
+    // least one thread per pool and one dispatch thread once it is used up
+    int available = GetAvailableThreads();
+    {
+        CPUExecutor first(2, 1024, {});
+        int first_threads =
+            first.get_num_thread_pools() * first.get_num_threads_per_pool() +
+            first.get_num_dispatch_threads();
+        EXPECT_LE(first_threads, max(available, 3));
+        EXPECT_EQ(GetAvailableThreads(), max(0, available - first_threads));
+
+        CPUExecutor second(1, 1024, {});
+        EXPECT_LE(second.get_num_threads_per_pool(), max(1, available - first_threads));
+        EXPECT_EQ(second.get_num_dispatch_threads(), 1);
+        int second_threads = second.get_num_threads_per_pool() + 1;
+        EXPECT_EQ(GetAvailableThreads(), max(0, available - first_threads - second_threads));
+    }
+    EXPECT_EQ(GetAvailableThreads(), available);
+}
+
+TEST(cpu_test, executor_parallel_for)
+{
+    runtime::cpu::executor::CPUExecutor executor(1, 4, {});
+    Eigen::TensorOpCost cost(1000, 1000, 100000);
+    for (size_t n : {1, 2, 3, 7, 64, 1000})
+    {
+        vector<atomic<int>> visits(n);
+        for (auto& visit : visits)
+        {
+            visit = 0;
+        }
+        atomic<size_t> blocks{0};
+        executor.parallel_for(0, n, cost, [&](size_t first, size_t last) {
+            EXPECT_LT(first, last);
+            EXPECT_LE(last, n);
+            for (size_t i = first; i < last; i++)
+            {
+                visits[i]++;
+            }
+            blocks++;
+        });
+        EXPECT_GE(blocks, 1);
+        for (size_t i = 0; i < n; i++)
+        {
+            EXPECT_EQ(visits[i], 1) << "n = " << n << ", i = " << i;
+        }
+    }
+
+    bool called = false;
+    executor.parallel_for(0, 0, cost, [&](size_t, size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
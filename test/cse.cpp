@@ -341,3 +341,38 @@ TEST(CSE, pass_property)
     ASSERT_EQ(true, pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_EQ(false, pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+#ifndef NGRAPH_JSON_DISABLE
+TEST(CSE, generic_attributes)
+{
+    Shape shape{4, 8};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    // A mask computation repeated per layer, built from ops without dedicated handlers
+    auto make_mask = [&](const Coordinate& upper) {
+        auto slice = std::make_shared<op::Slice>(A, Coordinate{0, 0}, upper);
+        auto elu = std::make_shared<op::Elu>(slice, 0.5);
+        return std::make_shared<op::Convert>(elu, element::f64);
+    };
+    auto mask0 = make_mask(Coordinate{4, 4});
+    auto mask1 = make_mask(Coordinate{4, 4});
+    auto mask2 = make_mask(Coordinate{4, 8});
+    auto elu_other_alpha = std::make_shared<op::Elu>(A, 1.0);
+    auto elu_same_alpha = std::make_shared<op::Elu>(A, 0.5);
+    auto convert_i32 = std::make_shared<op::Convert>(elu_same_alpha, element::i32);
+    auto convert_f64 = std::make_shared<op::Convert>(elu_same_alpha, element::f64);
+    auto f = std::make_shared<Function>(
+        NodeVector{mask0, mask1, mask2, elu_other_alpha, convert_i32, convert_f64},
+        ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    auto result_arg = [&](size_t i) { return f->get_results().at(i)->get_argument(0); };
+    ASSERT_EQ(result_arg(0), result_arg(1));
+    ASSERT_NE(result_arg(0), result_arg(2));
+    ASSERT_NE(result_arg(3), result_arg(4)->get_argument(0));
+    ASSERT_NE(result_arg(4), result_arg(5));
+    ASSERT_EQ(result_arg(4)->get_argument(0), result_arg(5)->get_argument(0));
+}
+#endif
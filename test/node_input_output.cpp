@@ -111,3 +111,30 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+TEST(node_input_output, many_inputs_stable_addresses)
+{
+    NodeVector args;
+    for (size_t i = 0; i < 8; i++)
+    {
+        args.push_back(make_shared<op::Parameter>(element::f32, Shape{2}));
+    }
+    auto concat = make_shared<op::Concat>(args, 0);
+
+    ASSERT_EQ(concat->get_input_size(), 8);
+    vector<descriptor::Input*> addresses;
+    for (size_t i = 0; i < concat->get_input_size(); i++)
+    {
+        addresses.push_back(&concat->get_inputs().at(i));
+        EXPECT_EQ(concat->input(i).get_source_output(), Output<Node>(args.at(i), 0));
+    }
+
+    // Input descriptors are referenced from their source outputs, so they must not move.
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto& target_inputs = args.at(i)->get_outputs().at(0).get_inputs();
+        ASSERT_EQ(target_inputs.size(), 1);
+        EXPECT_EQ(*target_inputs.begin(), addresses.at(i));
+    }
+    EXPECT_EQ(concat->description(), "Concat");
+}
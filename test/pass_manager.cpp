@@ -21,9 +21,11 @@
 
 #include "gtest/gtest.h"
 
+#include "ngraph/compile_profiler.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -67,3 +69,51 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+TEST(pass_manager, compile_profiler)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto reshape = make_shared<op::Reshape>(arg, AxisVector{0, 1}, Shape{2, 3});
+    auto f = make_shared<Function>(make_shared<op::Abs>(reshape), ParameterVector{arg});
+
+    bool was_enabled = CompileProfiler::is_enabled();
+    CompileProfiler::enable();
+    CompileProfiler::reset();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.run_passes(f);
+    if (!was_enabled)
+    {
+        CompileProfiler::disable();
+    }
+
+    bool found_pass = false;
+    for (auto& record : CompileProfiler::get_passes())
+    {
+        if (record.name == "ngraph::pass::ReshapeElimination")
+        {
+            found_pass = true;
+            EXPECT_EQ(record.nodes_before, 4);
+            EXPECT_EQ(record.nodes_after, 3);
+        }
+    }
+    EXPECT_TRUE(found_pass);
+
+    size_t attempts = 0;
+    size_t rewrites = 0;
+    for (auto& matcher : CompileProfiler::get_matchers())
+    {
+        EXPECT_EQ(matcher.first.first, "ngraph::pass::ReshapeElimination");
+        attempts += matcher.second.attempts;
+        rewrites += matcher.second.rewrites;
+    }
+    EXPECT_GT(attempts, 0);
+    EXPECT_EQ(rewrites, 1);
+
+#ifndef NGRAPH_JSON_DISABLE
+    EXPECT_NE(CompileProfiler::to_json().find("ReshapeElimination"), string::npos);
+#endif
+    // An unwritable destination is reported, not thrown
+    EXPECT_FALSE(CompileProfiler::write("/nonexistent/ngraph_compile_profile"));
+    CompileProfiler::reset();
+}
@@ -27,6 +27,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "util/test_tools.hpp"
 
@@ -236,3 +237,150 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_planner, reuse_beats_program_order)
+{
+    // Placing buffers in program order leaves a one byte hole that the two byte buffer cannot
+    // use; placing the largest buffer first does not.
+    auto add_buffers = [](pass::MemoryPlanner& planner) {
+        planner.add_buffer(1, 0, 0);
+        planner.add_buffer(1, 0, 2);
+        planner.add_buffer(2, 1, 1);
+    };
+
+    pass::MemoryPlanner in_order{1, pass::MemoryPlanner::strategy::GREEDY_BY_ORDER};
+    add_buffers(in_order);
+    EXPECT_EQ(4, in_order.plan());
+    EXPECT_EQ(3, in_order.lower_bound());
+
+    pass::MemoryPlanner best{1};
+    add_buffers(best);
+    EXPECT_EQ(3, best.plan());
+    EXPECT_EQ(best.lower_bound(), best.peak());
+    EXPECT_EQ(0, best.get_offset(2));
+    EXPECT_EQ(2, best.get_offset(1));
+}
+
+TEST(memory_planner, exact_is_valid_and_no_worse)
+{
+    vector<tuple<size_t, size_t, size_t>> buffers{
+        {4, 0, 1}, {3, 1, 3}, {5, 2, 2}, {2, 0, 4}, {3, 3, 5}, {4, 4, 5}, {1, 2, 5}};
+    pass::MemoryPlanner best{1};
+    pass::MemoryPlanner exact{1, pass::MemoryPlanner::strategy::EXACT};
+    for (auto& b : buffers)
+    {
+        best.add_buffer(get<0>(b), get<1>(b), get<2>(b));
+        exact.add_buffer(get<0>(b), get<1>(b), get<2>(b));
+    }
+    best.plan();
+    exact.plan();
+    EXPECT_LE(exact.peak(), best.peak());
+    EXPECT_GE(exact.peak(), exact.lower_bound());
+
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+        size_t offset_i = exact.get_offset(i);
+        EXPECT_LE(offset_i + get<0>(buffers[i]), exact.peak());
+        for (size_t j = i + 1; j < buffers.size(); j++)
+        {
+            bool live_together = get<1>(buffers[i]) <= get<2>(buffers[j]) &&
+                                 get<1>(buffers[j]) <= get<2>(buffers[i]);
+            size_t offset_j = exact.get_offset(j);
+            bool share_memory = offset_i < offset_j + get<0>(buffers[j]) &&
+                                offset_j < offset_i + get<0>(buffers[i]);
+            EXPECT_FALSE(live_together && share_memory) << "buffers " << i << " and " << j;
+        }
+    }
+}
+
+TEST(memory_planner, alignment_and_unbounded_lifetime)
+{
+    pass::MemoryPlanner planner{8};
+    auto a = planner.add_buffer(3, 0);
+    auto b = planner.add_buffer(10, 1, 1);
+    auto c = planner.add_buffer(5, 2, 2);
+    planner.plan();
+    EXPECT_EQ(24, planner.peak());
+    EXPECT_EQ(24, planner.lower_bound());
+    EXPECT_EQ(0, planner.get_offset(b) % 8);
+    EXPECT_EQ(planner.get_offset(b), planner.get_offset(c));
+    EXPECT_NE(planner.get_offset(a), planner.get_offset(b));
+}
+
+TEST(memory_planner, many_buffers_do_not_overlap)
+{
+    // Enough buffers that conflicts come from the lifetime index rather than a small graph
+    vector<tuple<size_t, size_t, size_t>> buffers;
+    for (size_t i = 0; i < 2000; i++)
+    {
+        size_t size = 1 + (i * 7919) % 97;
+        size_t last_use = i % 50 == 0 ? pass::MemoryPlanner::end_of_program : i + (i * 31) % 23;
+        buffers.emplace_back(size, i / 2, last_use);
+    }
+    pass::MemoryPlanner planner{1};
+    for (auto& b : buffers)
+    {
+        planner.add_buffer(get<0>(b), get<1>(b), get<2>(b));
+    }
+    planner.plan();
+    EXPECT_GE(planner.peak(), planner.lower_bound());
+
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+        size_t offset_i = planner.get_offset(i);
+        ASSERT_LE(offset_i + get<0>(buffers[i]), planner.peak());
+        for (size_t j = i + 1; j < buffers.size(); j++)
+        {
+            bool live_together = get<1>(buffers[i]) <= get<2>(buffers[j]) &&
+                                 get<1>(buffers[j]) <= get<2>(buffers[i]);
+            size_t offset_j = planner.get_offset(j);
+            bool share_memory = offset_i < offset_j + get<0>(buffers[j]) &&
+                                offset_j < offset_i + get<0>(buffers[i]);
+            ASSERT_FALSE(live_together && share_memory) << "buffers " << i << " and " << j;
+        }
+    }
+}
+
+// The default depth-first order materializes `a` before computing the index, so both large
+// temporaries are live at once. Computing the index first needs only one.
+static shared_ptr<Function> make_gather_graph()
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{});
+    auto y = make_shared<op::Parameter>(element::f32, Shape{});
+    auto a = make_shared<op::Broadcast>(x, Shape{1000}, AxisSet{0});
+    auto b = make_shared<op::Broadcast>(y, Shape{1000}, AxisSet{0});
+    auto index = make_shared<op::Convert>(make_shared<op::Sum>(b, AxisSet{0}), element::i64);
+    auto gather = make_shared<op::Gather>(a, index);
+    return make_shared<Function>(gather, ParameterVector{x, y});
+}
+
+static size_t pool_size(shared_ptr<Function> f, bool schedule, size_t max_level_skew)
+{
+    pass::Manager pass_manager;
+    if (schedule)
+    {
+        pass_manager.register_pass<pass::MemorySchedule>(max_level_skew);
+    }
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    EXPECT_TRUE(validate_list(f->get_ordered_ops()));
+    return f->get_temporary_pool_size();
+}
+
+TEST(memory_schedule, reduces_peak)
+{
+    size_t unbounded = numeric_limits<size_t>::max();
+    size_t default_order = pool_size(make_gather_graph(), false, unbounded);
+    size_t scheduled = pool_size(make_gather_graph(), true, unbounded);
+    EXPECT_GE(default_order, 8000);
+    EXPECT_LT(scheduled, 4100);
+}
+
+TEST(memory_schedule, level_skew_bound)
+{
+    // With no skew both broadcasts sit at the same depth and must stay adjacent
+    size_t default_order = pool_size(make_gather_graph(), false, 0);
+    EXPECT_EQ(default_order, pool_size(make_gather_graph(), true, 0));
+    EXPECT_LT(pool_size(make_gather_graph(), true, 1), default_order);
+}
@@ -745,3 +745,81 @@ TEST(pattern, is_contained_match)
     ASSERT_TRUE(n.match(label_abs2, absn2));
     ASSERT_FALSE(n.is_contained_match());
 }
+
+TEST(pattern, graph_rewrite_matcher_dispatch)
+{
+    // Typed matchers only see nodes of their root type, wildcard matchers see every node, and
+    // both are tried in registration order
+    Shape shape{2};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto b = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(a + b) * b, ParameterVector{a, b});
+
+    vector<string> calls;
+    class DispatchGraphRewrite : public pass::GraphRewrite
+    {
+    public:
+        void add(const shared_ptr<Node>& pattern, const string& name, vector<string>& calls)
+        {
+            auto callback = [name, &calls](pattern::Matcher& m) {
+                calls.push_back(name + ":" + m.get_match_root()->description());
+                return false;
+            };
+            add_matcher(make_shared<pattern::Matcher>(pattern, name), callback);
+        }
+    };
+
+    auto label = make_shared<pattern::op::Label>(element::f32, shape);
+    auto any_node = make_shared<pattern::op::Label>(
+        element::f32, shape, [](shared_ptr<Node> n) { return !n->is_parameter(); });
+    DispatchGraphRewrite rewrite;
+    rewrite.add(make_shared<op::Abs>(label), "abs", calls);
+    rewrite.add(any_node, "any", calls);
+    rewrite.add(label + label, "add", calls);
+    rewrite.run_on_function(f);
+
+    EXPECT_EQ(calls,
+              (vector<string>{"any:Add", "abs:Abs", "any:Abs", "any:Multiply", "any:Result"}));
+}
+
+TEST(pattern, graph_rewrite_incremental)
+{
+    // Abs(x) is rewritten to Negative(x); Negative nodes are rewritten to Sign. The Negative
+    // created by the first rewrite is only visited in incremental mode.
+    auto make_rewrite = []() {
+        auto rewrite = make_shared<pass::GraphRewrite>();
+        auto label = make_shared<pattern::op::Label>(element::f32, Shape{2});
+        rewrite->add_matcher(make_shared<pattern::Matcher>(make_shared<op::Abs>(label), "abs"),
+                             [label](pattern::Matcher& m) {
+                                 auto arg = m.get_pattern_map()[label];
+                                 replace_node(m.get_match_root(), make_shared<op::Negative>(arg));
+                                 return true;
+                             });
+        rewrite->add_matcher(
+            make_shared<pattern::Matcher>(make_shared<op::Negative>(label), "negative"),
+            [label](pattern::Matcher& m) {
+                auto arg = m.get_pattern_map()[label];
+                replace_node(m.get_match_root(), make_shared<op::Sign>(arg));
+                return true;
+            });
+        return rewrite;
+    };
+
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+        return make_shared<Function>(make_shared<op::Abs>(a), ParameterVector{a});
+    };
+
+    auto f = make_function();
+    make_rewrite()->run_on_function(f);
+    EXPECT_EQ(count_ops_of_type<op::Negative>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Sign>(f), 0);
+
+    f = make_function();
+    auto rewrite = make_rewrite();
+    rewrite->set_incremental(true);
+    rewrite->run_on_function(f);
+    EXPECT_EQ(count_ops_of_type<op::Abs>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Sign>(f), 1);
+}
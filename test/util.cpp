@@ -394,6 +394,122 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+TEST(graph_util, ordered_ops_cache_invalidation)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(neg, ParameterVector{A, B});
+
+    auto first = f->get_ordered_ops();
+    auto second = f->get_ordered_ops();
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(first.size(), 5);
+
+    // Rewiring an input must invalidate the cached order
+    auto abs = make_shared<op::Abs>(add);
+    replace_node(neg, abs);
+    auto sorted = f->get_ordered_ops();
+    ASSERT_EQ(sorted.size(), 5);
+    EXPECT_NE(find(sorted.begin(), sorted.end(), abs), sorted.end());
+    EXPECT_EQ(find(sorted.begin(), sorted.end(), neg), sorted.end());
+
+    // So must adding a control dependency
+    auto sub = A - B;
+    abs->add_control_dependency(sub);
+    sorted = f->get_ordered_ops();
+    ASSERT_EQ(sorted.size(), 6);
+    auto sub_it = find(sorted.begin(), sorted.end(), sub);
+    ASSERT_NE(sub_it, sorted.end());
+    EXPECT_LT(sub_it, find(sorted.begin(), sorted.end(), abs));
+    EXPECT_EQ(f->get_ordered_ops(false).size(), 5);
+}
+
+TEST(graph_util, ordered_ops_cache_lifetime)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(neg, ParameterVector{A, B});
+    const auto& ops = f->get_ordered_ops();
+    EXPECT_EQ(&ops, &f->get_ordered_ops());
+
+    // Building and dropping nodes does not rewire the graph
+    size_t version = Node::get_topology_version();
+    {
+        auto unused = make_shared<op::Abs>(add);
+    }
+    EXPECT_EQ(Node::get_topology_version(), version);
+
+    // The cache lets go of a replaced node once it is stale
+    weak_ptr<Node> weak_neg = neg;
+    replace_node(neg, make_shared<op::Abs>(add));
+    neg.reset();
+    f->release_stale_ordered_ops();
+    EXPECT_TRUE(weak_neg.expired());
+    EXPECT_EQ(f->get_ordered_ops().size(), 5);
+}
+
+TEST(graph_util, ordered_ops_schedule)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::Negative>(A);
+    auto abs = make_shared<op::Abs>(A);
+    auto f = make_shared<Function>(NodeVector{neg, abs}, ParameterVector{A});
+    auto r0 = f->get_results().at(0);
+    auto r1 = f->get_results().at(1);
+
+    vector<shared_ptr<Node>> schedule{A, abs, r1, neg, r0};
+    f->set_ordered_ops(schedule);
+    EXPECT_EQ(f->get_ordered_ops(), schedule);
+    EXPECT_THROW(f->set_ordered_ops({A, neg, abs, r1}), ngraph_error);
+    EXPECT_THROW(f->set_ordered_ops({A, abs, neg, r1, r0, make_shared<op::Negative>(A)}),
+                 ngraph_error);
+
+    // Edits to other graphs keep the schedule
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(make_shared<op::Negative>(B), ParameterVector{B});
+    replace_node(g->get_results().at(0)->get_argument(0), make_shared<op::Abs>(B));
+    EXPECT_EQ(f->get_ordered_ops(), schedule);
+
+    // Replacing one of its nodes discards it
+    auto relu = make_shared<op::Relu>(A);
+    replace_node(abs, relu);
+    auto sorted = f->get_ordered_ops();
+    ASSERT_EQ(sorted.size(), 5);
+    EXPECT_NE(find(sorted.begin(), sorted.end(), relu), sorted.end());
+    EXPECT_EQ(find(sorted.begin(), sorted.end(), abs), sorted.end());
+}
+
+TEST(graph_util, revalidate_dirty_nodes)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto y = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto add = make_shared<op::Add>(x, y);
+    auto neg = make_shared<op::Negative>(add);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(abs, ParameterVector{x, y});
+    EXPECT_EQ(f->revalidate_dirty_nodes(), 0);
+
+    // Same output type, so only the user of the replacement is revalidated
+    replace_node(add, make_shared<op::Abs>(x));
+    EXPECT_TRUE(neg->needs_validation());
+    EXPECT_EQ(f->revalidate_dirty_nodes(), 1);
+    EXPECT_FALSE(neg->needs_validation());
+
+    // A new shape propagates through all users
+    x->set_partial_shape(PartialShape{4, 3});
+    EXPECT_EQ(f->revalidate_dirty_nodes(), 5);
+    EXPECT_EQ(abs->get_shape(), (Shape{4, 3}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{4, 3}));
+    EXPECT_EQ(f->revalidate_dirty_nodes(), 0);
+}
+
 TEST(util, enum_mask_construction)
 {
     enum class Type : uint32_t
@@ -128,7 +128,7 @@ vector<float> read_float_vector(shared_ptr<runtime::Tensor> tv)
 
 // This function traverses the list of ops and verifies that each op's dependencies (its inputs)
 // is located earlier in the list. That is enough to be valid
-bool validate_list(const list<shared_ptr<Node>>& nodes)
+bool validate_list(const vector<shared_ptr<Node>>& nodes)
 {
     bool rc = true;
     for (auto it = nodes.rbegin(); it != nodes.rend(); it++)